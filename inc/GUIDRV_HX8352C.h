@@ -38,26 +38,58 @@ extern const GUI_DEVICE_API GUIDRV_HX8352C_API;
 #define GUIDRV_HX8352C &GUIDRV_HX8352C_API
 
 
+/**
+ * @name    Orientation flags for GUIDRV_HX8352C_SetOrientation(), same as R16h bits
+ * @{
+ */
+//! Swap X-Y axis
+#define HX8352C_SWAP_XY     0x0020
+//! Mirror X axis (before swapping)
+#define HX8352C_MIRROR_X    0x0040
+//! Mirror Y axis (before swapping)
+#define HX8352C_MIRROR_Y    0x0080
+/** @} */
+
+
 typedef struct _HX8352C_HW_API
 {
     //! Reset LCD controller
     void (*pfWriteReg)(U16 data);
     //! Write 16-bit data to LCD (RS = 1)
     void (*pfWriteData)(U16 data);
+    //! Write list of register/value pairs to LCD, optional
+    void (*pfWriteRegSequence)(const U16 *pPairs, unsigned int count);
     //! Write data buffer to LCD (RS = 0)
     void (*pfWriteMultipleData)(U16 *pData, unsigned int count);
     //! Write same data to LCD multiple times (RS = 0)
     void (*pfWriteRepeatingData)(U16 data, unsigned int count);
+    //! Write 8-bit indexed data buffer through palette to LCD (RS = 0), optional
+    void (*pfWriteMultipleDataLUT)(const U8 *pIndex, const LCD_PIXELINDEX *pLUT, unsigned int count);
+    //! Write a row of 2bpp packed pixels through palette to LCD (RS = 0), optional
+    void (*pfWriteMultipleData2BPP)(const U8 *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT);
+    //! Write a row of 4bpp packed pixels through palette to LCD (RS = 0), optional
+    void (*pfWriteMultipleData4BPP)(const U8 *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT);
     //! Read Register from LCD (RS = 1)
     U16 (*pfReadReg)(void);
     //! Read GRAM from LCD (RS = 1)
     U16 (*pfReadData)(void);
     //! Read multiple 16-bit data from LCD GRAM (RS = 1)
     void (*pfReadMultipleData)(U16 *pData, unsigned int count);
+    //! Read GRAM pixels from LCD as RGB565, including dummy read (RS = 1), optional
+    void (*pfReadPixels565)(U16 *pData, unsigned int count);
+    //! Write data buffer to LCD in background (RS = 1), optional
+    void (*pfWriteMultipleDataAsync)(U16 *pData, unsigned int count, void (*pfDone)(void));
+    //! Wait until background write completes, required with pfWriteMultipleDataAsync
+    void (*pfWaitIdle)(void);
 } HX8352C_HW_API;
 
 
 void GUIDRV_HX8352C_SetFunc(GUI_DEVICE *device, HX8352C_HW_API *pAPI);
+int GUIDRV_HX8352C_SetOrientation(int orientation);
+int GUIDRV_HX8352C_MEMDEV_Draw(GUI_RECT *pRect, GUI_CALLBACK_VOID_P *pfDraw, void *pData, int numLines);
+void GUIDRV_HX8352C_CACHE_GetSize(int *pxSize, int *pySize);
+int GUIDRV_HX8352C_CACHE_Write(int xCache, int yCache, const GUI_BITMAP GUI_UNI_PTR *pBitmap);
+int GUIDRV_HX8352C_CACHE_Draw(int xCache, int yCache, int xSize, int ySize, int x, int y);
 
 
 #endif  // GUIDRV_HX8352C_H
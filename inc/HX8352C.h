@@ -21,26 +21,52 @@
 #ifndef HX8352C_H
 #define HX8352C_H
 
+#include <stdint.h>
+#include "GUI.h"
+
 // Low level functions implemented using ARM assembly
 
 //! @fn  void lcdWriteData(uint16_t data)
 void lcdWriteData(uint16_t data);
 //! @fn  void lcdWriteReg(uint16_t data)
 void lcdWriteReg(uint16_t data);
+//! @fn  void lcdWriteRegSequence(const uint16_t *pPairs, unsigned int count)
+void lcdWriteRegSequence(const uint16_t *pPairs, unsigned int count);
 //! @fn  void lcdWriteRepeatingData(uint16_t data, unsigned int count)
 void lcdWriteRepeatingData(uint16_t data, unsigned int count);
 //! @fn  void lcdWriteMultipleData(uint16_t *pData, unsigned int count)
 void lcdWriteMultipleData(uint16_t *pData, unsigned int count);
+//! @fn  void lcdWriteMultipleDataLUT(const uint8_t *pIndex, const LCD_PIXELINDEX *pLUT, unsigned int count)
+void lcdWriteMultipleDataLUT(const uint8_t *pIndex, const LCD_PIXELINDEX *pLUT, unsigned int count);
+//! @fn  void lcdWriteMultipleData2BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+void lcdWriteMultipleData2BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT);
+//! @fn  void lcdWriteMultipleData4BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+void lcdWriteMultipleData4BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT);
 //! @fn uint16_t lcdReadData(void)
 uint16_t lcdReadData(void);
 //! @fn uint16_t lcdReadReg(void)
 uint16_t lcdReadReg(void);
 //! @fn void lcdReadMultipleData(uint16_t *pData, unsigned int count)
 void lcdReadMultipleData(uint16_t *pData, unsigned int count);
+//! @fn void lcdReadPixels565(uint16_t *pData, unsigned int count)
+void lcdReadPixels565(uint16_t *pData, unsigned int count);
+
+// Background (TIM8 + DMA2, SysTick) functions
+
+//! @fn void lcdWriteMultipleDataAsync(uint16_t *pData, unsigned int count, void (*pfDone)(void))
+void lcdWriteMultipleDataAsync(uint16_t *pData, unsigned int count, void (*pfDone)(void));
+//! @fn int lcdIsBusy(void)
+int lcdIsBusy(void);
+//! @fn void lcdWaitIdle(void)
+void lcdWaitIdle(void);
 
 // C functions
+//! @fn void lcdTick(void)
+void lcdTick(void);
 //! @fn void lcdReset(void)
 void lcdReset(void);
+//! @fn void lcdInitStart(void)
+void lcdInitStart(void);
 //! @fn void lcdInit(void)
 void lcdInit(void);
 //! @fn void lcdOn(void);
@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    HX8352C_GPIO_Conf.h
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Board wiring of the GPIO 16-bit interface for HX8352C LCD controller
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   This file is included by both HX8352C_GPIO.c and the preprocessed
+  *         HX8352C_GPIO_Lowlevel.s, so it may only contain plain numeric
+  *         defines. Each value can be overridden from the compiler command
+  *         line (e.g. -DLCD_Data_GPIOx_BASE=0x40010800) for another board.
+  ******************************************************************************
+  */
+
+#ifndef HX8352C_GPIO_CONF_H
+#define HX8352C_GPIO_CONF_H
+
+// LCD 16-bit data bus  GPIOB
+// Reset                GPIOC.4
+// RS                   GPIOC.5
+// WR                   GPIOC.6
+// RD                   GPIOC.7
+// CS                   Wired to GND
+
+#ifndef LCD_Data_GPIOx_BASE
+//! GPIOx_BASE of the port connected to LCD data bus (GPIOB)
+#define LCD_Data_GPIOx_BASE     0x40010C00
+#endif
+
+#ifndef LCD_Ctrl_GPIOx_BASE
+//! GPIOx_BASE of the port connected to LCD control lines (GPIOC)
+#define LCD_Ctrl_GPIOx_BASE     0x40011000
+#endif
+
+#ifndef LCD_RST_Pin
+//! GPIO_Pin_x of the LCD Reset pin
+#define LCD_RST_Pin             0x0010
+#endif
+
+#ifndef LCD_RS_Pin
+//! GPIO_Pin_x of the LCD RS pin
+#define LCD_RS_Pin              0x0020
+#endif
+
+#ifndef LCD_WR_PinSource
+//! GPIO_PinSourcex of the LCD WR pin, must be TIM8 CH1 (6) for asynchronous write
+#define LCD_WR_PinSource        6
+#endif
+
+//! GPIO_Pin_x of the LCD WR pin
+#define LCD_WR_Pin              (1 << LCD_WR_PinSource)
+
+#ifndef LCD_RD_Pin
+//! GPIO_Pin_x of the LCD RD pin
+#define LCD_RD_Pin              0x0080
+#endif
+
+#endif // HX8352C_GPIO_CONF_H
+
+/*************************** End of file ****************************/
@@ -31,7 +31,7 @@
 #define LCDCONF_H
 
 /**
- * @name    Configuration for panel rotation
+ * @name    Start-up panel rotation, GUIDRV_HX8352C_SetOrientation() changes it at runtime
  * @note    Normal rotation:    SWAP_XY = 0, MIRROR_X = 0, MIRROR_Y = 0
  *          Rotate 90:          SWAP_XY = 1, MIRROR_X = 1, MIRROR_Y = 0
  *          Rotate 180:         SWAP_XY = 0, MIRROR_X = 1, MIRROR_Y = 1
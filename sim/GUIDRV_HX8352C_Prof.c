@@ -0,0 +1,283 @@
+/**
+  ******************************************************************************
+  * @file    GUIDRV_HX8352C_Prof.c
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Per-primitive bus accounting for GUIDRV_HX8352C on host
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   Link the device with GUIDRV_HX8352C_PROF_API instead of
+  *         GUIDRV_HX8352C_API. Every call is forwarded to the driver and the
+  *         bus traffic it generates is charged to a simulator section named
+  *         after the primitive. Use lcdSimPrintStat() to show the result.
+  ******************************************************************************
+  */
+
+#include "GUI.h"
+#include "GUIDRV_HX8352C.h"
+#include "HX8352C_Sim.h"
+
+
+/*===========================================================================*/
+/* Static Data                                                               */
+/*===========================================================================*/
+
+//! Section names of _DrawBitmap, indexed by bits per pixel
+static const char * const _apBitmapSection[] =
+{
+    "DrawBitmap",
+    "DrawBitmap 1bpp",
+    "DrawBitmap 2bpp",
+    "DrawBitmap",
+    "DrawBitmap 4bpp",
+    "DrawBitmap",
+    "DrawBitmap",
+    "DrawBitmap",
+    "DrawBitmap 8bpp",
+    "DrawBitmap",
+    "DrawBitmap",
+    "DrawBitmap",
+    "DrawBitmap",
+    "DrawBitmap",
+    "DrawBitmap",
+    "DrawBitmap",
+    "DrawBitmap 16bpp"
+};
+
+//! Driver's LCD_DEVFUNC_READRECT function
+static void (*_pfReadRect)(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1, LCD_PIXELINDEX *pBuffer);
+
+//! Driver's LCD_DEVFUNC_COPYRECT function
+static void (*_pfCopyRect)(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1, int xSize, int ySize);
+
+//! Driver's LCD_DEVFUNC_DRAWBMP_16BPP function
+static void (*_pfDrawBmp16BPP)(GUI_DEVICE *pDevice, int x, int y, const U16 *pData, int xSize, int ySize, int bytesPerLine);
+
+
+/*===========================================================================*/
+/* Static Functions                                                          */
+/*===========================================================================*/
+
+/**
+ * @brief   Forward to driver's _DrawBitmap, charged per bits per pixel
+ */
+static void _DrawBitmap(GUI_DEVICE *pDevice, int x0, int y0, int xSize, int ySize, int BitsPerPixel, int BytesPerLine, const U8 *pData, int Diff, const LCD_PIXELINDEX *pTrans)
+{
+    const char *prev;
+    const char *name = _apBitmapSection[0];
+    if ((BitsPerPixel > 0) && (BitsPerPixel < (int)GUI_COUNTOF(_apBitmapSection)))
+        name = _apBitmapSection[BitsPerPixel];
+    else if (BitsPerPixel == 24)
+        name = "DrawBitmap 24bpp";
+    else if (BitsPerPixel == 32)
+        name = "DrawBitmap 32bpp";
+    prev = lcdSimBeginSection(name);
+    GUIDRV_HX8352C_API.pfDrawBitmap(pDevice, x0, y0, xSize, ySize, BitsPerPixel, BytesPerLine, pData, Diff, pTrans);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's _DrawHLine
+ */
+static void _DrawHLine(GUI_DEVICE *pDevice, int x0, int y, int x1)
+{
+    const char *prev = lcdSimBeginSection("DrawHLine");
+    GUIDRV_HX8352C_API.pfDrawHLine(pDevice, x0, y, x1);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's _DrawVLine
+ */
+static void _DrawVLine(GUI_DEVICE *pDevice, int x, int y0, int y1)
+{
+    const char *prev = lcdSimBeginSection("DrawVLine");
+    GUIDRV_HX8352C_API.pfDrawVLine(pDevice, x, y0, y1);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's _FillRect
+ */
+static void _FillRect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1)
+{
+    const char *prev = lcdSimBeginSection("FillRect");
+    GUIDRV_HX8352C_API.pfFillRect(pDevice, x0, y0, x1, y1);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's _GetPixelIndex
+ */
+static unsigned int _GetPixelIndex(GUI_DEVICE *pDevice, int x, int y)
+{
+    unsigned int index;
+    const char *prev = lcdSimBeginSection("GetPixelIndex");
+    index = GUIDRV_HX8352C_API.pfGetPixelIndex(pDevice, x, y);
+    lcdSimEndSection(prev);
+    return index;
+}
+
+
+/**
+ * @brief   Forward to driver's _SetPixelIndex
+ */
+static void _SetPixelIndex(GUI_DEVICE *pDevice, int x, int y, int index)
+{
+    const char *prev = lcdSimBeginSection("SetPixelIndex");
+    GUIDRV_HX8352C_API.pfSetPixelIndex(pDevice, x, y, index);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's _XorPixel
+ */
+static void _XorPixel(GUI_DEVICE *pDevice, int x, int y)
+{
+    const char *prev = lcdSimBeginSection("XorPixel");
+    GUIDRV_HX8352C_API.pfXorPixel(pDevice, x, y);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's _SetOrg
+ */
+static void _SetOrg(GUI_DEVICE *pDevice, int x, int y)
+{
+    const char *prev = lcdSimBeginSection("SetOrg");
+    GUIDRV_HX8352C_API.pfSetOrg(pDevice, x, y);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's LCD_DEVFUNC_READRECT function
+ */
+static void _ReadRect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1, LCD_PIXELINDEX *pBuffer)
+{
+    const char *prev = lcdSimBeginSection("ReadRect");
+    _pfReadRect(pDevice, x0, y0, x1, y1, pBuffer);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's LCD_DEVFUNC_COPYRECT function
+ */
+static void _CopyRect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1, int xSize, int ySize)
+{
+    const char *prev = lcdSimBeginSection("CopyRect");
+    _pfCopyRect(pDevice, x0, y0, x1, y1, xSize, ySize);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Forward to driver's LCD_DEVFUNC_DRAWBMP_16BPP function
+ */
+static void _DrawBmp16BPP(GUI_DEVICE *pDevice, int x, int y, const U16 *pData, int xSize, int ySize, int bytesPerLine)
+{
+    const char *prev = lcdSimBeginSection("DrawBmp16BPP");
+    _pfDrawBmp16BPP(pDevice, x, y, pData, xSize, ySize, bytesPerLine);
+    lcdSimEndSection(prev);
+}
+
+
+/**
+ * @brief   Return driver's function pointers, wrapped where traffic is charged
+ */
+static void (* _GetDevFunc(GUI_DEVICE **ppDevice, int index))(void)
+{
+    void (*pFunc)(void);
+    pFunc = GUIDRV_HX8352C_API.pfGetDevFunc(ppDevice, index);
+    if (pFunc == NULL)
+        return NULL;
+    switch (index)
+    {
+    case LCD_DEVFUNC_READRECT:
+        _pfReadRect = (void (*)(GUI_DEVICE *, int, int, int, int, LCD_PIXELINDEX *))pFunc;
+        return (void (*)(void))_ReadRect;
+    case LCD_DEVFUNC_COPYRECT:
+        _pfCopyRect = (void (*)(GUI_DEVICE *, int, int, int, int, int, int))pFunc;
+        return (void (*)(void))_CopyRect;
+    case LCD_DEVFUNC_DRAWBMP_16BPP:
+        _pfDrawBmp16BPP = (void (*)(GUI_DEVICE *, int, int, const U16 *, int, int, int))pFunc;
+        return (void (*)(void))_DrawBmp16BPP;
+    }
+    return pFunc;
+}
+
+
+/**
+ * @brief   Forward to driver's _GetDevProp
+ */
+static I32 _GetDevProp(GUI_DEVICE *pDevice, int index)
+{
+    return GUIDRV_HX8352C_API.pfGetDevProp(pDevice, index);
+}
+
+
+/**
+ * @brief   Forward to driver's _GetDevData
+ */
+static void * _GetDevData(GUI_DEVICE *pDevice, int index)
+{
+    return GUIDRV_HX8352C_API.pfGetDevData(pDevice, index);
+}
+
+
+/**
+ * @brief   Forward to driver's _GetRect
+ */
+static void _GetRect(GUI_DEVICE *pDevice, LCD_RECT *pRect)
+{
+    GUIDRV_HX8352C_API.pfGetRect(pDevice, pRect);
+}
+
+
+/*===========================================================================*/
+/* Public Data                                                               */
+/*===========================================================================*/
+
+/**
+ * @brief Profiling device driver description table
+ */
+const GUI_DEVICE_API GUIDRV_HX8352C_PROF_API =
+{
+    // Data
+    DEVICE_CLASS_DRIVER,
+    // Drawing functions
+    _DrawBitmap,
+    _DrawHLine,
+    _DrawVLine,
+    _FillRect,
+    _GetPixelIndex,
+    _SetPixelIndex,
+    _XorPixel,
+    // Set origin
+    _SetOrg,
+    // Request information
+    _GetDevFunc,
+    _GetDevProp,
+    _GetDevData,
+    _GetRect,
+};
+
+
+
+/*************************** End of file ****************************/
@@ -0,0 +1,460 @@
+/**
+  ******************************************************************************
+  * @file    GUI_Stub.c
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Minimal emWin implementation for the host build of GUIDRV_HX8352C
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   Just enough of emWin to run the driver on a workstation: one layer,
+  *         GUICC_565, the drawing context fields the driver reads and 16bpp
+  *         memory devices which are flushed as 16bpp bitmaps.
+  *         Nothing is drawn by this file itself.
+  ******************************************************************************
+  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "GUI.h"
+#include "GUI_Private.h"
+
+
+/*===========================================================================*/
+/* Defines                                                                   */
+/*===========================================================================*/
+
+//! Memory devices alive at the same time
+#define STUB_MAX_MEMDEV 4
+
+//! Fill pattern of GUI_ALLOC_GetFixedBlock(), emWin does not clear the block
+#define STUB_ALLOC_FILL 0xA5
+
+
+/*===========================================================================*/
+/* Types                                                                     */
+/*===========================================================================*/
+
+/**
+ * @brief   16bpp memory device
+ */
+typedef struct _STUB_MEMDEV
+{
+    //! Non-zero while created
+    int used;
+    //! Position on the screen
+    int x0, y0;
+    //! Size, ySize can be reduced below the allocated height
+    int xSize, ySize;
+    //! Pixel data, xSize * allocated height
+    U16 *pData;
+} STUB_MEMDEV;
+
+
+/*===========================================================================*/
+/* Static Data                                                               */
+/*===========================================================================*/
+
+//! Drawing context
+static GUI_CONTEXT _context;
+//! Display driver of layer 0
+static GUI_DEVICE *_pDriver;
+//! Memory devices, handle is index + 1
+static STUB_MEMDEV _memdev[STUB_MAX_MEMDEV];
+//! Selected memory device, 0 for none
+static GUI_MEMDEV_Handle _hSel;
+//! Palette conversion table
+static LCD_PIXELINDEX _palConv[256];
+
+
+/*===========================================================================*/
+/* Public Data                                                               */
+/*===========================================================================*/
+
+GUI_CONTEXT *GUI_pContext = &_context;
+
+const GUI_BITMAP_METHODS GUI_BitmapMethods565 = { 0 };
+
+//! Only its address is used, as LCD_DEVDATA_MEMDEV
+const GUI_DEVICE_API GUI_MEMDEV_DEVICE_16 = { DEVICE_CLASS_DRIVER };
+
+
+/*===========================================================================*/
+/* Static Functions                                                          */
+/*===========================================================================*/
+
+/**
+ * @brief   Color to index, red in the least significant bits
+ */
+static LCD_PIXELINDEX _Color2Index565(LCD_COLOR color)
+{
+    return ((color & 0xF8) >> 3) | ((color & 0xFC00) >> 5) | ((color & 0xF80000) >> 8);
+}
+
+
+/**
+ * @brief   Index to color, components get their MSBs replicated
+ */
+static LCD_COLOR _Index2Color565(LCD_PIXELINDEX index)
+{
+    U32 r, g, b;
+    r = index & 0x1F;
+    g = (index >> 5) & 0x3F;
+    b = (index >> 11) & 0x1F;
+    r = (r << 3) | (r >> 2);
+    g = (g << 2) | (g >> 4);
+    b = (b << 3) | (b >> 2);
+    return r | (g << 8) | (b << 16);
+}
+
+
+/**
+ * @brief   Index mask of 16bpp
+ */
+static LCD_PIXELINDEX _GetIndexMask565(void)
+{
+    return 0xFFFF;
+}
+
+
+/**
+ * @brief   Get memory device from handle
+ */
+static STUB_MEMDEV *_GetMemdev(GUI_MEMDEV_Handle hMem)
+{
+    if ((hMem < 1) || (hMem > STUB_MAX_MEMDEV) || !_memdev[hMem - 1].used)
+        return NULL;
+    return &_memdev[hMem - 1];
+}
+
+
+/*===========================================================================*/
+/* Public Functions                                                          */
+/*===========================================================================*/
+
+const LCD_API_COLOR_CONV LCD_API_ColorConv_565 =
+{
+    _Color2Index565,
+    _Index2Color565,
+    _GetIndexMask565,
+    1
+};
+
+
+/**
+ * @brief   Create the display driver of a layer, only layer 0 is supported
+ */
+GUI_DEVICE *GUI_DEVICE_CreateAndLink(const GUI_DEVICE_API *pDeviceAPI, const LCD_API_COLOR_CONV *pColorConvAPI, U16 Flags, int LayerIndex)
+{
+    GUI_DEVICE *pDevice;
+    if (LayerIndex != 0)
+        return NULL;
+    pDevice = (GUI_DEVICE *)calloc(1, sizeof(GUI_DEVICE));
+    pDevice->pDeviceAPI = pDeviceAPI;
+    pDevice->pColorConvAPI = pColorConvAPI;
+    pDevice->Flags = Flags;
+    pDevice->LayerIndex = LayerIndex;
+    _pDriver = pDevice;
+    return pDevice;
+}
+
+
+/**
+ * @brief   Get display driver of a layer
+ */
+GUI_DEVICE *GUI_DEVICE__GetpDriver(int LayerIndex)
+{
+    return (LayerIndex == 0) ? _pDriver : NULL;
+}
+
+
+/**
+ * @brief   Allocate a block that is never freed
+ */
+void *GUI_ALLOC_GetFixedBlock(int Size)
+{
+    void *p = malloc(Size);
+    if (p)
+        memset(p, STUB_ALLOC_FILL, Size);
+    return p;
+}
+
+
+/**
+ * @brief   Lock a memory device handle, returns its pixel data
+ */
+void *GUI_ALLOC_LockH(GUI_HMEM hMem)
+{
+    STUB_MEMDEV *pMem = _GetMemdev(hMem);
+    return pMem ? pMem->pData : NULL;
+}
+
+
+/**
+ * @brief   Unlock a pointer returned by GUI_ALLOC_LockH()
+ */
+void GUI_ALLOC_UnlockH(void **pp)
+{
+    *pp = NULL;
+}
+
+
+/**
+ * @brief   Bits per pixel of an index mask
+ */
+int LCD__GetBPP(LCD_PIXELINDEX IndexMask)
+{
+    int bpp = 0;
+    while (IndexMask)
+    {
+        ++bpp;
+        IndexMask >>= 1;
+    }
+    return bpp;
+}
+
+
+/**
+ * @brief   Set clip rectangle to the screen of the selected layer
+ */
+void LCD_SetClipRectMax(void)
+{
+    GUI_DEVICE *pDevice = GUI_DEVICE__GetpDriver(GUI_pContext->SelLayer);
+    if (pDevice)
+        pDevice->pDeviceAPI->pfGetRect(pDevice, &GUI_pContext->ClipRect);
+}
+
+
+/**
+ * @brief   Convert a palette to color indexes
+ */
+const LCD_PIXELINDEX *LCD_GetpPalConvTable(const LCD_LOGPALETTE GUI_UNI_PTR *pLogPal)
+{
+    int i;
+    for (i = 0; (i < pLogPal->NumEntries) && (i < (int)GUI_COUNTOF(_palConv)); ++i)
+        _palConv[i] = _Color2Index565(pLogPal->pPalEntries[i]);
+    return _palConv;
+}
+
+
+/**
+ * @brief   Initialize the display controller of layer 0
+ */
+int LCD_Init(void)
+{
+    int (*pfInit)(GUI_DEVICE *);
+    GUI_DEVICE *pDevice = _pDriver;
+    if (pDevice == NULL)
+        return 1;
+    pfInit = (int (*)(GUI_DEVICE *))pDevice->pDeviceAPI->pfGetDevFunc(&pDevice, LCD_DEVFUNC_INIT);
+    return pfInit ? pfInit(pDevice) : 1;
+}
+
+
+/**
+ * @brief   Set virtual screen size of a layer
+ */
+int LCD_SetVSizeEx(int LayerIndex, int xSize, int ySize)
+{
+    void (*pfSetVSize)(GUI_DEVICE *, int, int);
+    GUI_DEVICE *pDevice = GUI_DEVICE__GetpDriver(LayerIndex);
+    if (pDevice == NULL)
+        return 1;
+    pfSetVSize = (void (*)(GUI_DEVICE *, int, int))pDevice->pDeviceAPI->pfGetDevFunc(&pDevice, LCD_DEVFUNC_SET_VSIZE);
+    if (pfSetVSize == NULL)
+        return 1;
+    pfSetVSize(pDevice, xSize, ySize);
+    return 0;
+}
+
+
+/**
+ * @brief   Initialize emWin: create the display on first call, then (re)initialize the controller
+ * @note    Calling it again resets the drawing context and re-runs the
+ *          controller initialization, which the host check does before
+ *          every test.
+ */
+int GUI_Init(void)
+{
+    static LCD_PIXELINDEX colorIndex;
+    int r;
+    if (_pDriver == NULL)
+        LCD_X_Config();
+    memset(&_context, 0, sizeof(_context));
+    _context.LCD_pColorIndex = &colorIndex;
+    _hSel = 0;
+    r = LCD_Init();
+    LCD_SetClipRectMax();
+    return r;
+}
+
+
+/**
+ * @brief   Set origin of layer 0
+ */
+void GUI_SetOrg(int x, int y)
+{
+    if (_pDriver)
+        _pDriver->pDeviceAPI->pfSetOrg(_pDriver, x, y);
+}
+
+
+/**
+ * @brief   Create a 16bpp memory device
+ */
+GUI_MEMDEV_Handle GUI_MEMDEV_CreateFixed(int x0, int y0, int xSize, int ySize, int Flags, const GUI_DEVICE_API *pDeviceAPI, const LCD_API_COLOR_CONV *pColorConvAPI)
+{
+    int i;
+    GUI_USE_PARA(Flags);
+    GUI_USE_PARA(pColorConvAPI);
+    if (pDeviceAPI != GUI_MEMDEV_APILIST_16)
+        return 0;
+    for (i = 0; i < STUB_MAX_MEMDEV; ++i)
+    {
+        if (!_memdev[i].used)
+        {
+            _memdev[i].pData = (U16 *)calloc(xSize * ySize, sizeof(U16));
+            if (_memdev[i].pData == NULL)
+                return 0;
+            _memdev[i].used = 1;
+            _memdev[i].x0 = x0;
+            _memdev[i].y0 = y0;
+            _memdev[i].xSize = xSize;
+            _memdev[i].ySize = ySize;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+
+/**
+ * @brief   Delete a memory device
+ */
+void GUI_MEMDEV_Delete(GUI_MEMDEV_Handle hMem)
+{
+    STUB_MEMDEV *pMem = _GetMemdev(hMem);
+    if (pMem)
+    {
+        free(pMem->pData);
+        memset(pMem, 0, sizeof(*pMem));
+    }
+    if (_hSel == hMem)
+        _hSel = 0;
+}
+
+
+/**
+ * @brief   Select a memory device for drawing, 0 selects the display
+ * @return  Previously selected memory device
+ */
+GUI_MEMDEV_Handle GUI_MEMDEV_Select(GUI_MEMDEV_Handle hMem)
+{
+    GUI_MEMDEV_Handle hPrev = _hSel;
+    _hSel = hMem;
+    return hPrev;
+}
+
+
+/**
+ * @brief   Get selected memory device
+ */
+GUI_MEMDEV_Handle GUI_MEMDEV_GetSelMemdev(void)
+{
+    return _hSel;
+}
+
+
+/**
+ * @brief   Move a memory device
+ */
+void GUI_MEMDEV_SetOrg(GUI_MEMDEV_Handle hMem, int x0, int y0)
+{
+    STUB_MEMDEV *pMem = _GetMemdev(hMem);
+    if (pMem)
+    {
+        pMem->x0 = x0;
+        pMem->y0 = y0;
+    }
+}
+
+
+/**
+ * @brief   Reduce height of a memory device
+ */
+void GUI_MEMDEV_ReduceYSize(GUI_MEMDEV_Handle hMem, int YSize)
+{
+    STUB_MEMDEV *pMem = _GetMemdev(hMem);
+    if (pMem && (YSize < pMem->ySize))
+        pMem->ySize = YSize;
+}
+
+
+/**
+ * @brief   Copy a memory device to the display, clipped to the clip rectangle
+ * @note    The visible part is handed to pfDrawBitmap as one 16bpp bitmap.
+ *          Nothing is drawn if the device is completely clipped.
+ */
+void GUI_MEMDEV_CopyToLCD(GUI_MEMDEV_Handle hMem)
+{
+    STUB_MEMDEV *pMem = _GetMemdev(hMem);
+    GUI_DEVICE *pDevice = _pDriver;
+    const LCD_RECT *pClip = &GUI_pContext->ClipRect;
+    int x0, y0, x1, y1;
+
+    if ((pMem == NULL) || (pDevice == NULL))
+        return;
+    x0 = (pMem->x0 > pClip->x0) ? pMem->x0 : pClip->x0;
+    y0 = (pMem->y0 > pClip->y0) ? pMem->y0 : pClip->y0;
+    x1 = pMem->x0 + pMem->xSize - 1;
+    y1 = pMem->y0 + pMem->ySize - 1;
+    if (x1 > pClip->x1)
+        x1 = pClip->x1;
+    if (y1 > pClip->y1)
+        y1 = pClip->y1;
+    if ((x0 > x1) || (y0 > y1))
+        return;
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, x0, y0, x1 - x0 + 1, y1 - y0 + 1, 16, pMem->xSize * 2,
+                                      (const U8 *)(pMem->pData + (y0 - pMem->y0) * pMem->xSize + (x0 - pMem->x0)), 0, NULL);
+}
+
+
+/**
+ * @brief   Get pixel data of a memory device
+ */
+void *GUI_MEMDEV_GetDataPtr(GUI_MEMDEV_Handle hMem)
+{
+    STUB_MEMDEV *pMem = _GetMemdev(hMem);
+    return pMem ? pMem->pData : NULL;
+}
+
+
+/**
+ * @brief   Get width of a memory device
+ */
+int GUI_MEMDEV_GetXSize(GUI_MEMDEV_Handle hMem)
+{
+    STUB_MEMDEV *pMem = _GetMemdev(hMem);
+    return pMem ? pMem->xSize : 0;
+}
+
+
+/**
+ * @brief   Get height of a memory device
+ */
+int GUI_MEMDEV_GetYSize(GUI_MEMDEV_Handle hMem)
+{
+    STUB_MEMDEV *pMem = _GetMemdev(hMem);
+    return pMem ? pMem->ySize : 0;
+}
+
+
+/*************************** End of file ****************************/
@@ -0,0 +1,1122 @@
+/**
+  ******************************************************************************
+  * @file    HX8352C_Check.c
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Host-side behavior checks of GUIDRV_HX8352C against the simulator
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   Every check starts from a freshly initialized controller in normal
+  *         orientation (logical = GRAM coordinates), drives the driver through
+  *         its GUI_DEVICE_API and compares the whole screen, read with
+  *         lcdSimGetPixel(), against a reference image kept in _ref. Run
+  *         "make check" in the sim directory.
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "GUI.h"
+#include "GUI_Private.h"
+#include "LCDConf.h"
+#include "GUIDRV_HX8352C.h"
+#include "HX8352C_Sim.h"
+
+
+/*===========================================================================*/
+/* Defines                                                                   */
+/*===========================================================================*/
+
+/**
+ * @{
+ * Screen size in normal orientation
+ */
+#define XSIZE   240
+#define YSIZE   400
+/** @} */
+
+//! Background every check starts with
+#define COLOR_BK    0x1234
+
+//! Record a failed condition, checks go on after a failure
+#define CHECK(cond) _Check((cond) != 0, #cond, __LINE__)
+
+
+/*===========================================================================*/
+/* Types                                                                     */
+/*===========================================================================*/
+
+/**
+ * @brief   One named check
+ */
+typedef struct _CHECK_ENTRY
+{
+    //! Name printed in the report
+    const char *name;
+    //! Check function
+    void (*pfCheck)(void);
+} CHECK_ENTRY;
+
+
+/*===========================================================================*/
+/* Static Data                                                               */
+/*===========================================================================*/
+
+//! Expected screen content
+static U16 _ref[YSIZE][XSIZE];
+//! Failed conditions of the running check
+static int _numFailed;
+
+
+/*===========================================================================*/
+/* Helpers                                                                   */
+/*===========================================================================*/
+
+/**
+ * @brief   Report a failed condition
+ */
+static void _Check(int ok, const char *cond, int line)
+{
+    if (!ok)
+    {
+        ++_numFailed;
+        printf("    line %d: %s\n", line, cond);
+    }
+}
+
+
+/**
+ * @brief   Get the display driver
+ */
+static GUI_DEVICE *_GetDevice(void)
+{
+    return GUI_DEVICE__GetpDriver(0);
+}
+
+
+/**
+ * @brief   Get an optional driver function
+ */
+static void (*_GetDevFunc(int index))(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    return pDevice->pDeviceAPI->pfGetDevFunc(&pDevice, index);
+}
+
+
+/**
+ * @brief   Fill part of the reference image
+ */
+static void _RefFill(int x0, int y0, int x1, int y1, U16 color)
+{
+    int x, y;
+    for (y = y0; y <= y1; ++y)
+        for (x = x0; x <= x1; ++x)
+            _ref[y][x] = color;
+}
+
+
+/**
+ * @brief   Fill a logical rectangle of the reference image in the given orientation
+ * @note    Logical coordinates go to the address counter as they are, shifted
+ *          by 32 lines along the scroll axis when it is mirrored. R16h then
+ *          maps the address counter to GRAM.
+ */
+static void _RefFillLog(int orientation, int x0, int y0, int x1, int y1, U16 color)
+{
+    int x, y, col, row, gx, gy;
+    for (y = y0; y <= y1; ++y)
+    {
+        for (x = x0; x <= x1; ++x)
+        {
+            col = x;
+            row = y;
+            if (orientation & HX8352C_MIRROR_Y)
+            {
+                if (orientation & HX8352C_SWAP_XY)
+                    col += HX8352C_SIM_GRAM_YSIZE - YSIZE;
+                else
+                    row += HX8352C_SIM_GRAM_YSIZE - YSIZE;
+            }
+            gx = (orientation & HX8352C_SWAP_XY) ? row : col;
+            gy = (orientation & HX8352C_SWAP_XY) ? col : row;
+            if (orientation & HX8352C_MIRROR_X)
+                gx = XSIZE - 1 - gx;
+            if (orientation & HX8352C_MIRROR_Y)
+                gy = HX8352C_SIM_GRAM_YSIZE - 1 - gy;
+            _ref[gy][gx] = color;
+        }
+    }
+}
+
+
+/**
+ * @brief   Invert part of the reference image
+ */
+static void _RefXor(int x0, int y0, int x1, int y1)
+{
+    int x, y;
+    for (y = y0; y <= y1; ++y)
+        for (x = x0; x <= x1; ++x)
+            _ref[y][x] ^= 0xFFFF;
+}
+
+
+/**
+ * @brief   Copy a block of the reference image, source read completely before writing
+ */
+static void _RefCopy(int xSrc, int ySrc, int xDst, int yDst, int xSize, int ySize)
+{
+    static U16 block[YSIZE][XSIZE];
+    int x, y;
+    for (y = 0; y < ySize; ++y)
+        for (x = 0; x < xSize; ++x)
+            block[y][x] = _ref[ySrc + y][xSrc + x];
+    for (y = 0; y < ySize; ++y)
+        for (x = 0; x < xSize; ++x)
+            _ref[yDst + y][xDst + x] = block[y][x];
+}
+
+
+/**
+ * @brief   Draw a 1/2/4/8bpp bitmap into the reference image
+ * @note    As in the driver, the first pixel is bit group diff of the first
+ *          byte and lands at x0 + diff. Index 0 is skipped in transparent
+ *          mode, a non-zero index inverts the screen in XOR mode.
+ */
+static void _RefBitmap(int x0, int y0, int width, int height, int bpp, int stride, const U8 *pData, int diff, const LCD_PIXELINDEX *pTrans, int drawMode)
+{
+    int x, y, pos, index;
+    for (y = 0; y < height; ++y)
+    {
+        for (x = 0; x < width; ++x)
+        {
+            pos = (diff + x) * bpp;
+            index = (pData[y * stride + pos / 8] >> (8 - bpp - pos % 8)) & ((1 << bpp) - 1);
+            if ((drawMode & LCD_DRAWMODE_TRANS) && (index == 0))
+                continue;
+            if (drawMode & LCD_DRAWMODE_XOR)
+            {
+                if (index)
+                    _ref[y0 + y][x0 + diff + x] ^= 0xFFFF;
+                continue;
+            }
+            _ref[y0 + y][x0 + diff + x] = (U16)(pTrans ? pTrans[index] : (LCD_PIXELINDEX)index);
+        }
+    }
+}
+
+
+/**
+ * @brief   Fill GRAM and reference image with a pattern, bypassing the driver
+ */
+static void _SetPattern(void)
+{
+    int x, y;
+    for (y = 0; y < YSIZE; ++y)
+    {
+        for (x = 0; x < XSIZE; ++x)
+        {
+            _ref[y][x] = (U16)(x * 0x0101 + y * 0x1003);
+            lcdSimSetPixel(x, y, _ref[y][x]);
+        }
+    }
+}
+
+
+/**
+ * @brief   Compare the screen with the reference image
+ * @return  Number of different pixels, the first few are printed
+ */
+static int _CompareScreen(void)
+{
+    int x, y, diff = 0;
+    U16 pixel;
+    for (y = 0; y < YSIZE; ++y)
+    {
+        for (x = 0; x < XSIZE; ++x)
+        {
+            pixel = lcdSimGetPixel(x, y);
+            if (pixel != _ref[y][x])
+            {
+                if (diff < 4)
+                    printf("    (%d, %d) is %04X, expected %04X\n", x, y, pixel, _ref[y][x]);
+                ++diff;
+            }
+        }
+    }
+    return diff;
+}
+
+
+/**
+ * @brief   Reinitialize emWin and the controller, normal orientation, clear screen
+ */
+static void _Setup(void)
+{
+    HX8352C_HW_API hwAPI = {0};
+    int x, y;
+    GUI_Init();
+    LCD_X_GetSimAPI(&hwAPI);
+    GUIDRV_HX8352C_SetFunc(_GetDevice(), &hwAPI);
+    GUIDRV_HX8352C_SetOrientation(0);
+    LCD_SetVSizeEx(0, XSIZE, YSIZE);
+    for (y = 0; y < YSIZE; ++y)
+        for (x = 0; x < XSIZE; ++x)
+            lcdSimSetPixel(x, y, COLOR_BK);
+    _RefFill(0, 0, XSIZE - 1, YSIZE - 1, COLOR_BK);
+    GUI_pContext->DrawMode = LCD_DRAWMODE_NORMAL;
+    lcdSimDeferAsync(0);
+}
+
+
+/*===========================================================================*/
+/* Checks                                                                    */
+/*===========================================================================*/
+
+/**
+ * @brief   Pixels, lines and rectangles in normal draw mode
+ */
+static void _CheckFill(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    LCD__GetColorIndex() = 0xF800;
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 10, 20, 109, 69);
+    _RefFill(10, 20, 109, 69, 0xF800);
+    LCD__GetColorIndex() = 0x07E0;
+    pDevice->pDeviceAPI->pfDrawHLine(pDevice, 0, 399, 239);
+    _RefFill(0, 399, 239, 399, 0x07E0);
+    pDevice->pDeviceAPI->pfDrawHLine(pDevice, 5, 100, 6);
+    _RefFill(5, 100, 6, 100, 0x07E0);
+    pDevice->pDeviceAPI->pfDrawVLine(pDevice, 239, 0, 398);
+    _RefFill(239, 0, 239, 398, 0x07E0);
+    pDevice->pDeviceAPI->pfDrawVLine(pDevice, 50, 300, 301);
+    _RefFill(50, 300, 50, 301, 0x07E0);
+    pDevice->pDeviceAPI->pfSetPixelIndex(pDevice, 0, 0, 0x001F);
+    _ref[0][0] = 0x001F;
+    pDevice->pDeviceAPI->pfSetPixelIndex(pDevice, 200, 255, 0xFFFF);
+    _ref[255][200] = 0xFFFF;
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   Single pixel readback through the 18-bit read format
+ */
+static void _CheckRead(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    _SetPattern();
+    CHECK(pDevice->pDeviceAPI->pfGetPixelIndex(pDevice, 17, 33) == _ref[33][17]);
+    CHECK(pDevice->pDeviceAPI->pfGetPixelIndex(pDevice, 18, 33) == _ref[33][18]);
+    CHECK(pDevice->pDeviceAPI->pfGetPixelIndex(pDevice, 239, 399) == _ref[399][239]);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   16bpp bitmaps, contiguous and with padded lines
+ */
+static void _CheckBitmap16BPP(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    U16 data[12 * 6];
+    int x, y;
+    for (y = 0; y < 6; ++y)
+        for (x = 0; x < 12; ++x)
+            data[y * 12 + x] = (U16)(0x8000 + y * 12 + x);
+    // Contiguous
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 30, 40, 12, 6, 16, 24, (const U8 *)data, 0, NULL);
+    // Padded, left 10 pixels of each line
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 100, 300, 10, 6, 16, 24, (const U8 *)data, 0, NULL);
+    for (y = 0; y < 6; ++y)
+    {
+        for (x = 0; x < 12; ++x)
+        {
+            _ref[40 + y][30 + x] = data[y * 12 + x];
+            if (x < 10)
+                _ref[300 + y][100 + x] = data[y * 12 + x];
+        }
+    }
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   Window registers are fully programmed after the controller is initialized
+ * @note    The window cache held coordinates with 0xFF low bytes before the
+ *          controller reset, none of them may be taken as still programmed.
+ */
+static void _CheckWindowInit(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    unsigned int reg;
+    LCD__GetColorIndex() = 0x4321;
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 0, 255, 239, 255);
+    _RefFill(0, 255, 239, 255, 0x4321);
+    CHECK(_CompareScreen() == 0);
+    // Controller reset clears GRAM
+    GUI_Init();
+    GUIDRV_HX8352C_SetOrientation(0);
+    _RefFill(0, 0, XSIZE - 1, YSIZE - 1, 0);
+    CHECK(lcdSimGetReg(0x05) == 239);
+    CHECK(lcdSimGetReg(0x08) == 399 >> 8);
+    CHECK(lcdSimGetReg(0x09) == (399 & 0xFF));
+    for (reg = 0x02; reg <= 0x04; ++reg)
+        CHECK(lcdSimGetReg(reg) == 0);
+    CHECK(lcdSimGetReg(0x06) == 0);
+    CHECK(lcdSimGetReg(0x07) == 0);
+    pDevice->pDeviceAPI->pfSetPixelIndex(pDevice, 0, 255, 0x5555);
+    _ref[255][0] = 0x5555;
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 7, 255, 8, 256);
+    _RefFill(7, 255, 8, 256, 0x4321);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   Band callback of _CheckMemdevDraw, fills the selected memory device
+ * @note    Band 1 is clipped out, as if the window manager had no invalid
+ *          region there, so its flush makes no drawing call at all.
+ */
+static void _DrawBand(void *p)
+{
+    static const U16 aColor[] = { 0xF800, 0x07E0, 0x001F, 0xFFE0 };
+    int *pBand = (int *)p;
+    GUI_MEMDEV_Handle hMem = GUI_MEMDEV_GetSelMemdev();
+    U16 *pData = (U16 *)GUI_MEMDEV_GetDataPtr(hMem);
+    int i, n;
+    n = GUI_MEMDEV_GetXSize(hMem) * GUI_MEMDEV_GetYSize(hMem);
+    for (i = 0; i < n; ++i)
+        pData[i] = aColor[*pBand & 3];
+    GUI_pContext->ClipRect.y0 = (*pBand == 1) ? 20 : 0;
+    ++*pBand;
+}
+
+
+/**
+ * @brief   Double-buffered band drawing with DMA completing late
+ */
+static void _CheckMemdevDraw(void)
+{
+    GUI_RECT rect = { 20, 0, 219, 39 };
+    int band = 0;
+    lcdSimDeferAsync(1);
+    CHECK(GUIDRV_HX8352C_MEMDEV_Draw(&rect, _DrawBand, &band, 10) == 0);
+    CHECK(band == 4);
+    CHECK(lcdSimIsBusy() == 0);
+    CHECK(lcdSimGetAsyncConflicts() == 0);
+    _RefFill(20, 0, 219, 9, 0xF800);
+    _RefFill(20, 20, 219, 29, 0x001F);
+    _RefFill(20, 30, 219, 39, 0xFFE0);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   Only the mandatory hardware access functions are given
+ */
+static void _CheckMinimalAPI(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    HX8352C_HW_API hwAPI = {0};
+    hwAPI.pfWriteReg = lcdSimWriteReg;
+    hwAPI.pfWriteData = lcdSimWriteData;
+    hwAPI.pfWriteRepeatingData = lcdSimWriteRepeatingData;
+    hwAPI.pfWriteMultipleData = lcdSimWriteMultipleData;
+    hwAPI.pfReadMultipleData = lcdSimReadMultipleData;
+    GUIDRV_HX8352C_SetFunc(pDevice, &hwAPI);
+    LCD__GetColorIndex() = 0x7BEF;
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 3, 4, 200, 300);
+    _RefFill(3, 4, 200, 300, 0x7BEF);
+    pDevice->pDeviceAPI->pfSetPixelIndex(pDevice, 239, 399, 0x0001);
+    _ref[399][239] = 0x0001;
+    pDevice->pDeviceAPI->pfDrawVLine(pDevice, 0, 0, 399);
+    _RefFill(0, 0, 0, 399, 0x7BEF);
+    CHECK(_CompareScreen() == 0);
+    // Readback without pfReadPixels565, odd and even pixel counts
+    _SetPattern();
+    CHECK(pDevice->pDeviceAPI->pfGetPixelIndex(pDevice, 5, 6) == _ref[6][5]);
+    GUI_pContext->DrawMode = LCD_DRAWMODE_XOR;
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 10, 10, 110, 12);
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 10, 20, 11, 20);
+    _RefXor(10, 10, 110, 12);
+    _RefXor(10, 20, 11, 20);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   1bpp transparent bitmaps, runs of set bits across byte boundaries and up to the line end
+ */
+static void _CheckBitmap1BPPTrans(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    static const LCD_PIXELINDEX aTrans[2] = { 0x0000, 0xF81F };
+    static const U8 aData[5 * 6] =
+    {
+        0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x1F,
+        0x81, 0x00, 0xFF, 0xE0, 0x07, 0xFF,
+        0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8
+    };
+    _SetPattern();
+    GUI_pContext->DrawMode = LCD_DRAWMODE_TRANS;
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 50, 60, 45, 5, 1, 6, aData, 3, aTrans);
+    _RefBitmap(50, 60, 45, 5, 1, 6, aData, 3, aTrans, LCD_DRAWMODE_TRANS);
+    // Single line, no stride
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 0, 399, 48, 1, 1, 0, aData + 6, 0, aTrans);
+    _RefBitmap(0, 399, 48, 1, 1, 0, aData + 6, 0, aTrans, LCD_DRAWMODE_TRANS);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   1bpp opaque bitmaps, runs continuing across the line wrap and whole bytes
+ */
+static void _CheckBitmap1BPPOpaque(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    static const LCD_PIXELINDEX aTrans[2] = { 0x07E0, 0x001F };
+    static const U8 aData[6 * 4] =
+    {
+        0xF8, 0x00, 0xFF, 0xFF,     // Ends with set bits
+        0xFF, 0xFF, 0x00, 0x00,     // Starts with set bits, ends with clear bits
+        0x00, 0x00, 0x00, 0x00,     // All clear, one run with the end of the line above
+        0x00, 0xFF, 0x0F, 0x01,
+        0x03, 0xC3, 0xC3, 0xC0,
+        0xFF, 0xFF, 0xFF, 0xFF
+    };
+    _SetPattern();
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 100, 150, 27, 6, 1, 4, aData, 5, aTrans);
+    _RefBitmap(100, 150, 27, 6, 1, 4, aData, 5, aTrans, LCD_DRAWMODE_NORMAL);
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 10, 10, 32, 6, 1, 4, aData, 0, aTrans);
+    _RefBitmap(10, 10, 32, 6, 1, 4, aData, 0, aTrans, LCD_DRAWMODE_NORMAL);
+    // One pixel wide, every line wraps
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 239, 390, 1, 6, 1, 4, aData, 0, aTrans);
+    _RefBitmap(239, 390, 1, 6, 1, 4, aData, 0, aTrans, LCD_DRAWMODE_NORMAL);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   8bpp bitmaps through the palette kernel, contiguous and with padded lines
+ */
+static void _CheckBitmap8BPP(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    HX8352C_HW_API hwAPI = {0};
+    LCD_PIXELINDEX aTrans[256];
+    U8 data[16 * 9];
+    int i, pass;
+    for (i = 0; i < 256; ++i)
+        aTrans[i] = (LCD_PIXELINDEX)(i * 0x0107 + 0x2000) & 0xFFFF;
+    for (i = 0; i < (int)sizeof(data); ++i)
+        data[i] = (U8)(i * 29 + 7);
+    // Second pass without pfWriteMultipleDataLUT
+    for (pass = 0; pass < 2; ++pass)
+    {
+        if (pass)
+        {
+            LCD_X_GetSimAPI(&hwAPI);
+            hwAPI.pfWriteMultipleDataLUT = NULL;
+            GUIDRV_HX8352C_SetFunc(pDevice, &hwAPI);
+        }
+        // Contiguous, stride == width
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 10, 20 + pass * 100, 16, 9, 8, 16, data, 0, aTrans);
+        _RefBitmap(10, 20 + pass * 100, 16, 9, 8, 16, data, 0, aTrans, LCD_DRAWMODE_NORMAL);
+        // Padded, stride > width
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 60, 20 + pass * 100, 13, 9, 8, 16, data, 0, aTrans);
+        _RefBitmap(60, 20 + pass * 100, 13, 9, 8, 16, data, 0, aTrans, LCD_DRAWMODE_NORMAL);
+        // Single line
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 100, 20 + pass * 100, 100, 1, 8, 0, data, 0, aTrans);
+        _RefBitmap(100, 20 + pass * 100, 100, 1, 8, 0, data, 0, aTrans, LCD_DRAWMODE_NORMAL);
+        // Indices without palette
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 10, 60 + pass * 100, 13, 9, 8, 16, data, 0, NULL);
+        _RefBitmap(10, 60 + pass * 100, 13, 9, 8, 16, data, 0, NULL, LCD_DRAWMODE_NORMAL);
+    }
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   2bpp and 4bpp opaque bitmaps at every diff, with and without the expansion kernels
+ */
+static void _CheckBitmap2BPP4BPP(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    HX8352C_HW_API hwAPI = {0};
+    static const LCD_PIXELINDEX aTrans[16] =
+    {
+        0x0000, 0xF800, 0x07E0, 0x001F, 0xFFE0, 0xF81F, 0x07FF, 0xFFFF,
+        0x8410, 0x4208, 0xC618, 0x2104, 0xA514, 0x6318, 0xE71C, 0x1082
+    };
+    U8 data[8 * 5];
+    int i, diff, pass;
+    for (i = 0; i < (int)sizeof(data); ++i)
+        data[i] = (U8)(i * 0x3B + 0x1D);
+    // Second pass without pfWriteMultipleData2BPP and pfWriteMultipleData4BPP
+    for (pass = 0; pass < 2; ++pass)
+    {
+        if (pass)
+        {
+            LCD_X_GetSimAPI(&hwAPI);
+            hwAPI.pfWriteMultipleData2BPP = NULL;
+            hwAPI.pfWriteMultipleData4BPP = NULL;
+            GUIDRV_HX8352C_SetFunc(pDevice, &hwAPI);
+        }
+        for (diff = 0; diff < 4; ++diff)
+        {
+            pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 10 + diff * 50, 10 + pass * 100, 21, 5, 2, 8, data, diff, aTrans);
+            _RefBitmap(10 + diff * 50, 10 + pass * 100, 21, 5, 2, 8, data, diff, aTrans, LCD_DRAWMODE_NORMAL);
+        }
+        for (diff = 0; diff < 2; ++diff)
+        {
+            pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 10 + diff * 50, 30 + pass * 100, 13, 5, 4, 8, data, diff, aTrans);
+            _RefBitmap(10 + diff * 50, 30 + pass * 100, 13, 5, 4, 8, data, diff, aTrans, LCD_DRAWMODE_NORMAL);
+        }
+        // Single line, no stride
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 110, 30 + pass * 100, 16, 1, 4, 0, data, 0, aTrans);
+        _RefBitmap(110, 30 + pass * 100, 16, 1, 4, 0, data, 0, aTrans, LCD_DRAWMODE_NORMAL);
+        // Indices without palette
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 10, 50 + pass * 100, 7, 5, 2, 8, data, 1, NULL);
+        _RefBitmap(10, 50 + pass * 100, 7, 5, 2, 8, data, 1, NULL, LCD_DRAWMODE_NORMAL);
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 60, 50 + pass * 100, 7, 5, 4, 8, data, 1, NULL);
+        _RefBitmap(60, 50 + pass * 100, 7, 5, 4, 8, data, 1, NULL, LCD_DRAWMODE_NORMAL);
+    }
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   2/4/8bpp transparent bitmaps, spans between index 0 pixels at every diff
+ */
+static void _CheckBitmapTransSpans(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    HX8352C_HW_API hwAPI = {0};
+    LCD_PIXELINDEX aTrans[256];
+    U8 data[24 * 4];
+    U8 wide[100];
+    int i, diff;
+    for (i = 0; i < 256; ++i)
+        aTrans[i] = (LCD_PIXELINDEX)(0xFFFF - i * 0x0101) & 0xFFFF;
+    // Runs of zero and non-zero bits, ending at byte and line boundaries
+    for (i = 0; i < (int)sizeof(data); ++i)
+        data[i] = ((i % 5) == 1) ? 0x00 : (U8)(i * 0x47 + 0x91);
+    data[23] = 0xFF;
+    data[24] = 0xFF;
+    _SetPattern();
+    GUI_pContext->DrawMode = LCD_DRAWMODE_TRANS;
+    for (diff = 0; diff < 4; ++diff)
+    {
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 5 + diff * 55, 10, 50, 4, 2, 24, data, diff, aTrans);
+        _RefBitmap(5 + diff * 55, 10, 50, 4, 2, 24, data, diff, aTrans, LCD_DRAWMODE_TRANS);
+    }
+    for (diff = 0; diff < 2; ++diff)
+    {
+        pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 5 + diff * 55, 30, 47, 4, 4, 24, data, diff, aTrans);
+        _RefBitmap(5 + diff * 55, 30, 47, 4, 4, 24, data, diff, aTrans, LCD_DRAWMODE_TRANS);
+    }
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 5, 50, 24, 4, 8, 24, data, 0, aTrans);
+    _RefBitmap(5, 50, 24, 4, 8, 24, data, 0, aTrans, LCD_DRAWMODE_TRANS);
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 5, 60, 21, 4, 8, 24, data, 0, NULL);
+    _RefBitmap(5, 60, 21, 4, 8, 24, data, 0, NULL, LCD_DRAWMODE_TRANS);
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 60, 60, 21, 4, 4, 24, data, 1, NULL);
+    _RefBitmap(60, 60, 21, 4, 4, 24, data, 1, NULL, LCD_DRAWMODE_TRANS);
+    // Without the expansion hooks, spans longer than the expansion buffer
+    LCD_X_GetSimAPI(&hwAPI);
+    hwAPI.pfWriteMultipleDataLUT = NULL;
+    hwAPI.pfWriteMultipleData2BPP = NULL;
+    hwAPI.pfWriteMultipleData4BPP = NULL;
+    GUIDRV_HX8352C_SetFunc(pDevice, &hwAPI);
+    for (i = 0; i < (int)sizeof(wide); ++i)
+        wide[i] = (U8)(i * 0x23) | 0x41;
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 10, 80, 100, 1, 8, 0, wide, 0, aTrans);
+    _RefBitmap(10, 80, 100, 1, 8, 0, wide, 0, aTrans, LCD_DRAWMODE_TRANS);
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 10, 90, 200, 2, 4, 50, wide, 0, aTrans);
+    _RefBitmap(10, 90, 200, 2, 4, 50, wide, 0, aTrans, LCD_DRAWMODE_TRANS);
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 5, 100, 47, 4, 2, 24, data, 3, aTrans);
+    _RefBitmap(5, 100, 47, 4, 2, 24, data, 3, aTrans, LCD_DRAWMODE_TRANS);
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 60, 100, 21, 4, 8, 24, data, 0, NULL);
+    _RefBitmap(60, 100, 21, 4, 8, 24, data, 0, NULL, LCD_DRAWMODE_TRANS);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   XOR lines, rectangles and 1bpp bitmaps through windowed readback
+ * @note    Sizes go beyond the 64 pixel XOR buffer in both directions, with
+ *          partial last windows.
+ */
+static void _CheckXor(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    static const LCD_PIXELINDEX aTrans[2] = { 0x0000, 0xFFFF };
+    static const U8 aData[3 * 3] =
+    {
+        0xF0, 0x0F, 0xAA,
+        0x00, 0xFF, 0x81,
+        0x7E, 0x00, 0x01
+    };
+    _SetPattern();
+    GUI_pContext->DrawMode = LCD_DRAWMODE_XOR;
+    // Wider than the buffer, one line per window
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 3, 5, 202, 7);
+    _RefXor(3, 5, 202, 7);
+    // Narrow, several lines per window and a partial last window
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 30, 100, 39, 122);
+    _RefXor(30, 100, 39, 122);
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 100, 200, 164, 203);
+    _RefXor(100, 200, 164, 203);
+    pDevice->pDeviceAPI->pfDrawHLine(pDevice, 0, 300, 239);
+    _RefXor(0, 300, 239, 300);
+    pDevice->pDeviceAPI->pfDrawVLine(pDevice, 220, 50, 350);
+    _RefXor(220, 50, 220, 350);
+    pDevice->pDeviceAPI->pfXorPixel(pDevice, 239, 399);
+    _RefXor(239, 399, 239, 399);
+    // Overlapping twice restores the pattern
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 150, 150, 151, 151);
+    pDevice->pDeviceAPI->pfFillRect(pDevice, 150, 150, 151, 151);
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 50, 350, 20, 3, 1, 3, aData, 2, aTrans);
+    _RefBitmap(50, 350, 20, 3, 1, 3, aData, 2, aTrans, LCD_DRAWMODE_XOR);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   Color of line n of the virtual screen in _CheckScroll
+ */
+static U16 _LineColor(int n)
+{
+    return (U16)(n * 0x0123 + 0x0F0F);
+}
+
+
+/**
+ * @brief   Draw every line along the scroll axis in its own color
+ */
+static void _DrawScrollLines(GUI_DEVICE *pDevice, int swapped, int numLines)
+{
+    int n;
+    for (n = 0; n < numLines; ++n)
+    {
+        LCD__GetColorIndex() = _LineColor(n);
+        if (swapped)
+            pDevice->pDeviceAPI->pfDrawVLine(pDevice, n, 0, XSIZE - 1);
+        else
+            pDevice->pDeviceAPI->pfDrawHLine(pDevice, 0, n, XSIZE - 1);
+    }
+}
+
+
+/**
+ * @brief   Check every panel line shows line org + p, or org + 399 - p if mirrored
+ */
+static int _CheckScreenLines(int org, int mirrored)
+{
+    int p, n, diff = 0;
+    for (p = 0; p < YSIZE; ++p)
+    {
+        n = org + (mirrored ? YSIZE - 1 - p : p);
+        if ((lcdSimGetScreenPixel(0, p) != _LineColor(n)) ||
+            (lcdSimGetScreenPixel(XSIZE - 1, p) != _LineColor(n)))
+        {
+            if (diff < 4)
+                printf("    panel line %d is %04X, expected line %d\n", p, lcdSimGetScreenPixel(0, p), n);
+            ++diff;
+        }
+    }
+    return diff;
+}
+
+
+/**
+ * @brief   Virtual screen set after GUI_Init(), scrolling with and without mirrored scroll axis
+ */
+static void _CheckScroll(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    // Growing after GUI_Init() switches scrolling on
+    CHECK(LCD_SetVSizeEx(0, XSIZE, HX8352C_SIM_GRAM_YSIZE) == 0);
+    CHECK(pDevice->pDeviceAPI->pfGetDevProp(pDevice, LCD_DEVCAP_VYSIZE) == HX8352C_SIM_GRAM_YSIZE);
+    CHECK(lcdSimGetReg(0x10) == HX8352C_SIM_GRAM_YSIZE >> 8);
+    CHECK(lcdSimGetReg(0x11) == (HX8352C_SIM_GRAM_YSIZE & 0xFF));
+    _DrawScrollLines(pDevice, 0, HX8352C_SIM_GRAM_YSIZE);
+    GUI_SetOrg(0, 20);
+    CHECK(_CheckScreenLines(20, 0) == 0);
+    GUI_SetOrg(0, 32);
+    CHECK(_CheckScreenLines(32, 0) == 0);
+    // Mirrored scroll axis
+    GUIDRV_HX8352C_SetOrientation(HX8352C_MIRROR_Y);
+    _DrawScrollLines(pDevice, 0, HX8352C_SIM_GRAM_YSIZE);
+    GUI_SetOrg(0, 0);
+    CHECK(_CheckScreenLines(0, 1) == 0);
+    GUI_SetOrg(0, 25);
+    CHECK(_CheckScreenLines(25, 1) == 0);
+    GUIDRV_HX8352C_SetOrientation(HX8352C_SWAP_XY | HX8352C_MIRROR_X | HX8352C_MIRROR_Y);
+    _DrawScrollLines(pDevice, 1, HX8352C_SIM_GRAM_YSIZE);
+    GUI_SetOrg(7, 0);
+    CHECK(_CheckScreenLines(7, 1) == 0);
+    GUIDRV_HX8352C_SetOrientation(HX8352C_SWAP_XY);
+    _DrawScrollLines(pDevice, 1, HX8352C_SIM_GRAM_YSIZE);
+    GUI_SetOrg(31, 0);
+    CHECK(_CheckScreenLines(31, 0) == 0);
+    // Shrinking back switches scrolling off, the origin stays at 0
+    GUIDRV_HX8352C_SetOrientation(HX8352C_MIRROR_Y);
+    CHECK(LCD_SetVSizeEx(0, XSIZE, YSIZE) == 0);
+    CHECK(lcdSimGetReg(0x14) == 0);
+    CHECK(lcdSimGetReg(0x15) == 0);
+    _DrawScrollLines(pDevice, 0, YSIZE);
+    GUI_SetOrg(0, 10);
+    CHECK(lcdSimGetReg(0x15) == 0);
+    CHECK(_CheckScreenLines(0, 1) == 0);
+}
+
+
+/**
+ * @brief   Off-screen cache strip: size, upload to GRAM lines 400-431 and drawing to screen
+ */
+static void _CheckCache(void)
+{
+    static const LCD_COLOR aColor[4] = { 0x000000, 0x0000FF, 0x00FF00, 0xFF0000 };
+    static const GUI_LOGPALETTE pal = { 4, 0, aColor };
+    static const U8 aData2BPP[2 * 3] = { 0x1B, 0xE4, 0x00, 0xFF, 0x55, 0xAA };
+    static const LCD_PIXELINDEX aTrans[4] = { 0x0000, 0x001F, 0x07E0, 0xF800 };
+    U16 data565[20 * 8];
+    GUI_BITMAP bm565 = { 20, 8, 40, 16, NULL, NULL, GUI_DRAW_BMP565 };
+    GUI_BITMAP bm2BPP = { 8, 3, 2, 2, aData2BPP, &pal, NULL };
+    GUI_MEMDEV_Handle hMem;
+    int xSize, ySize, x, y;
+    for (y = 0; y < 8; ++y)
+        for (x = 0; x < 20; ++x)
+            data565[y * 20 + x] = (U16)(0xC000 + y * 20 + x);
+    bm565.pData = (const U8 *)data565;
+    GUIDRV_HX8352C_CACHE_GetSize(&xSize, &ySize);
+    CHECK((xSize == XSIZE) && (ySize == HX8352C_SIM_GRAM_YSIZE - YSIZE));
+    // Upload, the screen stays untouched
+    CHECK(GUIDRV_HX8352C_CACHE_Write(10, 5, &bm565) == 0);
+    CHECK(GUIDRV_HX8352C_CACHE_Write(230, 29, &bm2BPP) == 0);
+    CHECK(GUIDRV_HX8352C_CACHE_Write(230, 30, &bm2BPP) == 1);
+    CHECK(_CompareScreen() == 0);
+    for (y = 0; y < 8; ++y)
+        for (x = 0; x < 20; ++x)
+            CHECK(lcdSimGetPixel(10 + x, YSIZE + 5 + y) == data565[y * 20 + x]);
+    // Draw to screen, then clipped at the left and bottom
+    CHECK(GUIDRV_HX8352C_CACHE_Draw(10, 5, 20, 8, 100, 200) == 0);
+    for (y = 0; y < 8; ++y)
+        for (x = 0; x < 20; ++x)
+            _ref[200 + y][100 + x] = data565[y * 20 + x];
+    CHECK(GUIDRV_HX8352C_CACHE_Draw(230, 29, 8, 3, 0, 0) == 0);
+    _RefBitmap(0, 0, 8, 3, 2, 2, aData2BPP, 0, aTrans, LCD_DRAWMODE_NORMAL);
+    GUI_pContext->ClipRect.x0 = 5;
+    GUI_pContext->ClipRect.y1 = 396;
+    CHECK(GUIDRV_HX8352C_CACHE_Draw(10, 5, 20, 8, 0, 392) == 0);
+    for (y = 0; y < 5; ++y)
+        for (x = 5; x < 20; ++x)
+            _ref[392 + y][x] = data565[y * 20 + x];
+    CHECK(GUIDRV_HX8352C_CACHE_Draw(10, 30, 20, 8, 0, 0) == 1);
+    CHECK(_CompareScreen() == 0);
+    // Relative to the window, nothing is drawn into a memory device
+    LCD_SetClipRectMax();
+    GUI_pContext->xOff = 150;
+    GUI_pContext->yOff = 300;
+    CHECK(GUIDRV_HX8352C_CACHE_Draw(230, 29, 8, 3, 2, 4) == 0);
+    _RefBitmap(152, 304, 8, 3, 2, 2, aData2BPP, 0, aTrans, LCD_DRAWMODE_NORMAL);
+    hMem = GUI_MEMDEV_CreateFixed(0, 0, 20, 8, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_16, GUICC_565);
+    GUI_MEMDEV_Select(hMem);
+    CHECK(GUIDRV_HX8352C_CACHE_Draw(10, 5, 20, 8, 0, 0) == 1);
+    GUI_MEMDEV_Select(0);
+    GUI_MEMDEV_Delete(hMem);
+    GUI_pContext->xOff = 0;
+    GUI_pContext->yOff = 0;
+    CHECK(_CompareScreen() == 0);
+    // With mirrored scroll axis the cache is still off screen, uploaded again
+    LCD_SetClipRectMax();
+    GUIDRV_HX8352C_SetOrientation(HX8352C_MIRROR_Y);
+    CHECK(GUIDRV_HX8352C_CACHE_Write(10, 5, &bm565) == 0);
+    CHECK(_CompareScreen() == 0);
+    CHECK(GUIDRV_HX8352C_CACHE_Draw(10, 5, 20, 8, 50, 50) == 0);
+    for (y = 0; y < 8; ++y)
+        for (x = 0; x < 20; ++x)
+            _RefFillLog(HX8352C_MIRROR_Y, 50 + x, 50 + y, 50 + x, 50 + y, data565[y * 20 + x]);
+    CHECK(_CompareScreen() == 0);
+    // Virtual screen takes cache lines
+    LCD_SetVSizeEx(0, XSIZE, YSIZE + 20);
+    GUIDRV_HX8352C_CACHE_GetSize(&xSize, &ySize);
+    CHECK(ySize == HX8352C_SIM_GRAM_YSIZE - YSIZE - 20);
+}
+
+
+/**
+ * @brief   Device properties before the context exists, and all eight orientations
+ */
+static void _CheckOrientation(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    GUI_DEVICE fresh;
+    LCD_RECT rect;
+    int o, xSize, ySize;
+    // Properties are queried before LCD_X_Config() calls SetFunc, start-up
+    // orientation comes from LCDConf.h
+    memset(&fresh, 0, sizeof(fresh));
+    fresh.pDeviceAPI = &GUIDRV_HX8352C_API;
+    fresh.pColorConvAPI = GUICC_565;
+    xSize = LCD_SWAP_XY ? YSIZE : XSIZE;
+    ySize = LCD_SWAP_XY ? XSIZE : YSIZE;
+    CHECK(fresh.pDeviceAPI->pfGetDevProp(&fresh, LCD_DEVCAP_XSIZE) == xSize);
+    CHECK(fresh.pDeviceAPI->pfGetDevProp(&fresh, LCD_DEVCAP_YSIZE) == ySize);
+    memset(&rect, 0, sizeof(rect));
+    fresh.pDeviceAPI->pfGetRect(&fresh, &rect);
+    CHECK((rect.x1 == xSize - 1) && (rect.y1 == ySize - 1));
+    for (o = 0; o < 8; ++o)
+    {
+        int orientation = ((o & 1) ? HX8352C_SWAP_XY : 0) |
+            ((o & 2) ? HX8352C_MIRROR_X : 0) | ((o & 4) ? HX8352C_MIRROR_Y : 0);
+        CHECK(GUIDRV_HX8352C_SetOrientation(orientation) == 0);
+        xSize = pDevice->pDeviceAPI->pfGetDevProp(pDevice, LCD_DEVCAP_XSIZE);
+        ySize = pDevice->pDeviceAPI->pfGetDevProp(pDevice, LCD_DEVCAP_YSIZE);
+        CHECK(xSize == ((orientation & HX8352C_SWAP_XY) ? YSIZE : XSIZE));
+        CHECK(ySize == ((orientation & HX8352C_SWAP_XY) ? XSIZE : YSIZE));
+        pDevice->pDeviceAPI->pfGetRect(pDevice, &rect);
+        CHECK((rect.x1 == xSize - 1) && (rect.y1 == ySize - 1));
+        LCD__GetColorIndex() = (U16)(0x0841 * (o + 1));
+        pDevice->pDeviceAPI->pfFillRect(pDevice, 2, 1, 6, 3);
+        _RefFillLog(orientation, 2, 1, 6, 3, (U16)(0x0841 * (o + 1)));
+        pDevice->pDeviceAPI->pfSetPixelIndex(pDevice, xSize - 1, ySize - 1, 0xF000 + o);
+        _RefFillLog(orientation, xSize - 1, ySize - 1, xSize - 1, ySize - 1, (U16)(0xF000 + o));
+        pDevice->pDeviceAPI->pfDrawVLine(pDevice, xSize - 3, 10, 12);
+        _RefFillLog(orientation, xSize - 3, 10, xSize - 3, 12, (U16)(0x0841 * (o + 1)));
+        CHECK(pDevice->pDeviceAPI->pfGetPixelIndex(pDevice, 6, 3) == (U16)(0x0841 * (o + 1)));
+    }
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   Reference blend of a 32bpp pixel over a screen pixel, 0x00 opaque, 0xFF transparent
+ */
+static U16 _RefBlend(U32 color, U16 bkIndex)
+{
+    U32 bk, alpha, rb, g;
+    alpha = color >> 24;
+    if (alpha == 0xFF)
+        return bkIndex;
+    bk = (GUICC_565)->pfIndex2Color(bkIndex);
+    alpha += alpha >> 7;
+    rb = ((color & 0xFF00FF) * (256 - alpha) + (bk & 0xFF00FF) * alpha) >> 8;
+    g = ((color & 0x00FF00) * (256 - alpha) + (bk & 0x00FF00) * alpha) >> 8;
+    return (U16)(GUICC_565)->pfColor2Index((rb & 0xFF00FF) | (g & 0x00FF00));
+}
+
+
+/**
+ * @brief   32bpp bitmaps: alpha blending, XOR mode and palette indices
+ */
+static void _CheckBitmap32BPP(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    static const LCD_PIXELINDEX aTrans[4] = { 0x0000, 0xF800, 0x07E0, 0x001F };
+    U32 data[100 * 3];
+    int x, y;
+    _SetPattern();
+    // Opaque, semi-transparent and transparent runs, wider than one span
+    for (y = 0; y < 3; ++y)
+    {
+        for (x = 0; x < 100; ++x)
+        {
+            if ((x % 7) == 3)
+                data[y * 100 + x] = 0xFF000000;
+            else
+                data[y * 100 + x] = ((U32)((x * 37 + y * 101) & 0xFF) << 24) | (U32)(x * 0x020406 + y * 0x1000);
+        }
+    }
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 20, 30, 100, 3, 32, 400, (const U8 *)data, 0, NULL);
+    for (y = 0; y < 3; ++y)
+        for (x = 0; x < 100; ++x)
+            _ref[30 + y][20 + x] = _RefBlend(data[y * 100 + x], _ref[30 + y][20 + x]);
+    CHECK(_CompareScreen() == 0);
+    // XOR inverts under every pixel that is not fully transparent
+    GUI_pContext->DrawMode = LCD_DRAWMODE_XOR;
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 20, 200, 100, 2, 32, 400, (const U8 *)data, 0, NULL);
+    for (y = 0; y < 2; ++y)
+        for (x = 0; x < 100; ++x)
+            if ((data[y * 100 + x] >> 24) != 0xFF)
+                _ref[200 + y][20 + x] ^= 0xFFFF;
+    CHECK(_CompareScreen() == 0);
+    // Palette indices, no alpha
+    GUI_pContext->DrawMode = LCD_DRAWMODE_NORMAL;
+    for (x = 0; x < 100; ++x)
+        data[x] = (U32)(x & 3);
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 120, 300, 100, 1, 32, 0, (const U8 *)data, 0, aTrans);
+    for (x = 0; x < 100; ++x)
+        _ref[300][120 + x] = (U16)aTrans[x & 3];
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   24bpp bitmaps wider than one conversion burst, contiguous and with padded lines
+ */
+static void _CheckBitmap24BPP(void)
+{
+    GUI_DEVICE *pDevice = _GetDevice();
+    static U8 data[(150 * 3 + 2) * 3];
+    const U8 *p;
+    int i, x, y;
+    for (i = 0; i < (int)sizeof(data); ++i)
+        data[i] = (U8)(i * 13 + (i >> 8));
+    // Padded lines of 452 bytes
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 40, 100, 150, 3, 24, 150 * 3 + 2, data, 0, NULL);
+    // Contiguous lines of 129 pixels, two full bursts and one pixel
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, 0, 300, 129, 2, 24, 129 * 3, data, 0, NULL);
+    for (y = 0; y < 3; ++y)
+    {
+        for (x = 0; x < 150; ++x)
+        {
+            p = data + y * (150 * 3 + 2) + x * 3;
+            _ref[100 + y][40 + x] = (U16)(GUICC_565)->pfColor2Index(p[0] | ((U32)p[1] << 8) | ((U32)p[2] << 16));
+        }
+    }
+    for (i = 0; i < 2 * 129; ++i)
+    {
+        p = data + i * 3;
+        _ref[300 + i / 129][i % 129] = (U16)(GUICC_565)->pfColor2Index(p[0] | ((U32)p[1] << 8) | ((U32)p[2] << 16));
+    }
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   LCD_DEVFUNC_COPYRECT with overlapping source and destination in every direction
+ */
+static void _CheckCopyRect(void)
+{
+    static const int aMove[][2] =
+    {
+        { 5, 0 }, { -7, 0 }, { 0, 3 }, { 0, -4 }, { 3, 2 }, { -2, -1 }, { 1, -1 }, { -1, 1 }
+    };
+    void (*pfCopyRect)(GUI_DEVICE *, int, int, int, int, int, int);
+    GUI_DEVICE *pDevice = _GetDevice();
+    unsigned int i;
+    pfCopyRect = (void (*)(GUI_DEVICE *, int, int, int, int, int, int))_GetDevFunc(LCD_DEVFUNC_COPYRECT);
+    CHECK(pfCopyRect != NULL);
+    if (pfCopyRect == NULL)
+        return;
+    _SetPattern();
+    for (i = 0; i < GUI_COUNTOF(aMove); ++i)
+    {
+        // Wider than the copy buffer
+        pfCopyRect(pDevice, 20, 30, 20 + aMove[i][0], 30 + aMove[i][1], 150, 20);
+        _RefCopy(20, 30, 20 + aMove[i][0], 30 + aMove[i][1], 150, 20);
+        // Several lines per window
+        pfCopyRect(pDevice, 100, 200, 100 + aMove[i][0], 200 + aMove[i][1], 30, 40);
+        _RefCopy(100, 200, 100 + aMove[i][0], 200 + aMove[i][1], 30, 40);
+    }
+    // Not overlapping, up to the screen edge
+    pfCopyRect(pDevice, 0, 0, 200, 360, 40, 40);
+    _RefCopy(0, 0, 200, 360, 40, 40);
+    CHECK(_CompareScreen() == 0);
+}
+
+
+/**
+ * @brief   LCD_DEVFUNC_DRAWBMP_16BPP, contiguous, strided and a single line
+ */
+static void _CheckDrawBmp16BPP(void)
+{
+    void (*pfDrawBmp16BPP)(GUI_DEVICE *, int, int, const U16 *, int, int, int);
+    GUI_DEVICE *pDevice = _GetDevice();
+    U16 data[40 * 12];
+    int x, y;
+    pfDrawBmp16BPP = (void (*)(GUI_DEVICE *, int, int, const U16 *, int, int, int))_GetDevFunc(LCD_DEVFUNC_DRAWBMP_16BPP);
+    CHECK(pfDrawBmp16BPP != NULL);
+    if (pfDrawBmp16BPP == NULL)
+        return;
+    for (x = 0; x < 40 * 12; ++x)
+        data[x] = (U16)(x * 0x0209 + 0x0100);
+    // Contiguous, strided with 40 pixel lines and a single line
+    pfDrawBmp16BPP(pDevice, 10, 20, data, 40, 12, 80);
+    pfDrawBmp16BPP(pDevice, 100, 20, data, 33, 12, 80);
+    pfDrawBmp16BPP(pDevice, 0, 399, data, 240, 1, 480);
+    for (y = 0; y < 12; ++y)
+    {
+        for (x = 0; x < 40; ++x)
+        {
+            _ref[20 + y][10 + x] = data[y * 40 + x];
+            if (x < 33)
+                _ref[20 + y][100 + x] = data[y * 40 + x];
+        }
+    }
+    for (x = 0; x < 240; ++x)
+        _ref[399][x] = data[x];
+    CHECK(_CompareScreen() == 0);
+}
+
+
+
+/*===========================================================================*/
+/* Main                                                                      */
+/*===========================================================================*/
+
+//! All checks, in order
+static const CHECK_ENTRY _aCheck[] =
+{
+    { "Fill",              _CheckFill },
+    { "Read",              _CheckRead },
+    { "Bitmap16BPP",       _CheckBitmap16BPP },
+    { "WindowInit",        _CheckWindowInit },
+    { "MemdevDraw",        _CheckMemdevDraw },
+    { "MinimalAPI",        _CheckMinimalAPI },
+    { "Bitmap1BPPTrans",   _CheckBitmap1BPPTrans },
+    { "Bitmap1BPPOpaque",  _CheckBitmap1BPPOpaque },
+    { "Bitmap8BPP",        _CheckBitmap8BPP },
+    { "Bitmap2BPP4BPP",    _CheckBitmap2BPP4BPP },
+    { "BitmapTransSpans",  _CheckBitmapTransSpans },
+    { "Xor",               _CheckXor },
+    { "Scroll",            _CheckScroll },
+    { "Cache",             _CheckCache },
+    { "Orientation",       _CheckOrientation },
+    { "Bitmap32BPP",       _CheckBitmap32BPP },
+    { "Bitmap24BPP",       _CheckBitmap24BPP },
+    { "CopyRect",          _CheckCopyRect },
+    { "DrawBmp16BPP",      _CheckDrawBmp16BPP },
+};
+
+
+/**
+ * @brief   Run all checks
+ * @return  0 if every check passed
+ */
+int main(int argc, char *argv[])
+{
+    unsigned int i;
+    int failed = 0;
+
+    for (i = 0; i < GUI_COUNTOF(_aCheck); ++i)
+    {
+        _Setup();
+        _numFailed = 0;
+        _aCheck[i].pfCheck();
+        printf("%-4s %s\n", _numFailed ? "FAIL" : "ok", _aCheck[i].name);
+        if (_numFailed)
+            ++failed;
+    }
+    if ((argc > 1) && (strcmp(argv[1], "-s") == 0))
+        lcdSimPrintStat();
+    printf("%d of %d checks failed\n", failed, (int)GUI_COUNTOF(_aCheck));
+    return failed ? 1 : 0;
+}
+
+
+/*************************** End of file ****************************/
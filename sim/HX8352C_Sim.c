@@ -0,0 +1,750 @@
+/**
+  ******************************************************************************
+  * @file    HX8352C_Sim.c
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Host-side HX8352C bus simulator
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   Only the part of the controller used by GUIDRV_HX8352C is modelled:
+  *         register file, R02h-R09h window, R16h scan direction, R22h GRAM
+  *         access with address auto-increment and the 18-bit readback format
+  *         (3 words per 2 pixels, after one dummy word).
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "HX8352C_Sim.h"
+
+
+/*===========================================================================*/
+/* Defines                                                                   */
+/*===========================================================================*/
+
+//! GRAM access register
+#define REG_GRAM    0x22
+//! Memory access control register (scan direction)
+#define REG_MAC     0x16
+
+//! R16h bits
+#define MAC_ML      0x0010
+#define MAC_MV      0x0020
+#define MAC_MX      0x0040
+#define MAC_MY      0x0080
+
+//! Maximum number of accounting sections
+#define SIM_MAX_SECTIONS    32
+
+/**
+ * @{
+ * Bus cost model in ns, derived from the timing notes in HX8352C_GPIO_Lowlevel.s
+ * at 72MHz (13.9ns per cycle). Fixed costs cover call, literal pool loads and
+ * port setup, per-word costs are the measured WR/RD "L" + "H" durations.
+ */
+//! lcdWriteReg/lcdWriteData: 28ns WR "L", about 13 cycles per call
+#define SIM_NS_WRITE_SINGLE         180
+//! lcdWriteRegSequence: about 10 cycles setup
+#define SIM_NS_WRITE_SEQUENCE       139
+//! lcdWriteRegSequence: about 17 cycles per register/value pair
+#define SIM_NS_WRITE_SEQUENCE_PAIR  236
+//! lcdWriteMultipleData: about 16 cycles setup and alignment check
+#define SIM_NS_WRITE_MULTIPLE       222
+//! lcdWriteMultipleData: 8 cycles per pixel in the unrolled ldm block
+#define SIM_NS_WRITE_MULTIPLE_WORD  111
+//! lcdWriteMultipleData: about 10 cycles per head or tail pixel
+#define SIM_NS_WRITE_MULTIPLE_TAIL  139
+//! lcdWriteMultipleDataLUT: about 12 cycles setup
+#define SIM_NS_WRITE_LUT            167
+//! lcdWriteMultipleDataLUT: 11 cycles per pixel including lookup
+#define SIM_NS_WRITE_LUT_WORD       153
+//! lcdWriteMultipleData2BPP/4BPP: about 20 cycles setup
+#define SIM_NS_WRITE_PACKED         278
+//! lcdWriteMultipleData2BPP/4BPP: 11 cycles per pixel including lookup
+#define SIM_NS_WRITE_PACKED_WORD    153
+//! lcdWriteRepeatingData: about 16 cycles setup and computed jump
+#define SIM_NS_WRITE_REPEATING      222
+//! lcdWriteRepeatingData: 56ns WR "L" + 56ns WR "H"
+#define SIM_NS_WRITE_REPEATING_WORD 112
+//! lcdWriteMultipleDataAsync: CPU time to program TIM8 and DMA2
+#define SIM_NS_WRITE_ASYNC          1000
+//! lcdWriteMultipleDataAsync: one TIM8 write cycle of 12 ticks
+#define SIM_NS_WRITE_ASYNC_WORD     167
+//! lcdReadReg: 336ns RD "L" plus bus turnaround
+#define SIM_NS_READ_REG             556
+//! lcdReadData: 361ns RD "L" plus bus turnaround
+#define SIM_NS_READ_SINGLE          611
+//! lcdReadMultipleData: about 12 cycles setup and bus restore
+#define SIM_NS_READ_MULTIPLE        167
+//! lcdReadMultipleData: 361ns RD "L" + 112ns RD "H"
+#define SIM_NS_READ_MULTIPLE_WORD   473
+/** @} */
+
+
+/*===========================================================================*/
+/* Static Data                                                               */
+/*===========================================================================*/
+
+//! Register file
+static uint16_t _reg[256];
+//! Register selected by last lcdSimWriteReg()
+static uint8_t _index;
+//! GRAM content, stored in RGB565
+static uint16_t _gram[HX8352C_SIM_GRAM_YSIZE][HX8352C_SIM_GRAM_XSIZE];
+//! Address counter (column, row), in window (pre-R16h) coordinates
+static unsigned int _col, _row;
+//! Next GRAM read returns the dummy word
+static int _readDummy;
+//! Pending readback bytes
+static uint8_t _readBytes[3];
+//! Number of unconsumed bytes in _readBytes
+static int _readCount;
+//! Deferred asynchronous write, see lcdSimDeferAsync()
+static struct
+{
+    //! Transfers are held until lcdSimWaitIdle()
+    int defer;
+    //! Data of the pending transfer, NULL if none
+    uint16_t *pData;
+    //! Words of the pending transfer
+    unsigned int count;
+    //! Completion callback of the pending transfer
+    void (*pfDone)(void);
+    //! Bus accesses made while a transfer was pending
+    unsigned long conflicts;
+} _async;
+//! Accounting sections, section 0 collects traffic outside any section
+static HX8352C_SIM_STAT _stat[SIM_MAX_SECTIONS] = { { .name = "(other)" } };
+//! Number of sections in use
+static int _numStat = 1;
+//! Section being charged
+static HX8352C_SIM_STAT *_pStat = &_stat[0];
+
+
+/*===========================================================================*/
+/* Static Functions                                                          */
+/*===========================================================================*/
+
+
+/**
+ * @brief   Get 16-bit value of a register pair (high byte at reg, low byte at reg + 1)
+ */
+static inline unsigned int _RegPair(uint8_t reg)
+{
+    return ((_reg[reg] & 0xFF) << 8) | (_reg[reg + 1] & 0xFF);
+}
+
+
+/**
+ * @brief   Map address counter to GRAM location according to R16h
+ * @return  0 if the address falls outside GRAM
+ */
+static int _Map(unsigned int col, unsigned int row, unsigned int *px, unsigned int *py)
+{
+    unsigned int x, y;
+    if (_reg[REG_MAC] & MAC_MV)
+    {
+        x = row;
+        y = col;
+    }
+    else
+    {
+        x = col;
+        y = row;
+    }
+    if ((x >= HX8352C_SIM_GRAM_XSIZE) || (y >= HX8352C_SIM_GRAM_YSIZE))
+        return 0;
+    if (_reg[REG_MAC] & MAC_MX)
+        x = HX8352C_SIM_GRAM_XSIZE - 1 - x;
+    if (_reg[REG_MAC] & MAC_MY)
+        y = HX8352C_SIM_GRAM_YSIZE - 1 - y;
+    *px = x;
+    *py = y;
+    return 1;
+}
+
+
+/**
+ * @brief   Advance address counter inside the window, wrapping at the window end
+ */
+static inline void _Advance(void)
+{
+    if (_col >= _RegPair(0x04))
+    {
+        _col = _RegPair(0x02);
+        if (_row >= _RegPair(0x08))
+            _row = _RegPair(0x06);
+        else
+            ++_row;
+    }
+    else
+    {
+        ++_col;
+    }
+}
+
+
+/**
+ * @brief   Write one pixel at the address counter and advance
+ */
+static inline void _WritePixel(uint16_t data)
+{
+    unsigned int x, y;
+    if (_Map(_col, _row, &x, &y))
+        _gram[y][x] = data;
+    _Advance();
+}
+
+
+/**
+ * @brief   Read one pixel at the address counter as 3 bytes of 6-bit R, G, B and advance
+ */
+static void _ReadPixel(uint8_t *pBytes)
+{
+    unsigned int x, y, r, g, b;
+    uint16_t color = 0;
+    if (_Map(_col, _row, &x, &y))
+        color = _gram[y][x];
+    _Advance();
+    // Controller stores 18-bit color, 5-bit components get their MSB replicated
+    r = color >> 11;
+    g = (color >> 5) & 0x3F;
+    b = color & 0x1F;
+    pBytes[0] = (uint8_t)(((r << 1) | (r >> 4)) << 2);
+    pBytes[1] = (uint8_t)(g << 2);
+    pBytes[2] = (uint8_t)(((b << 1) | (b >> 4)) << 2);
+}
+
+
+/**
+ * @brief   Select register (RS = 0), not charged
+ * @note    Selecting R22h loads the address counter from window start and
+ *          arms the dummy read.
+ */
+static void _SelectReg(uint16_t data)
+{
+    _index = (uint8_t)data;
+    if (_index == REG_GRAM)
+    {
+        _col = _RegPair(0x02);
+        _row = _RegPair(0x06);
+        _readDummy = 1;
+        _readCount = 0;
+    }
+}
+
+
+/**
+ * @brief   Write register or GRAM data, not charged
+ */
+static inline void _WriteData(uint16_t data)
+{
+    if (_index == REG_GRAM)
+        _WritePixel(data);
+    else
+        _reg[_index] = data;
+}
+
+
+/**
+ * @brief   Fetch next byte of the readback stream
+ */
+static uint8_t _ReadByte(void)
+{
+    if (_readCount == 0)
+    {
+        _ReadPixel(_readBytes);
+        _readCount = 3;
+    }
+    return _readBytes[3 - _readCount--];
+}
+
+
+/**
+ * @brief   Read register or GRAM data, not charged
+ */
+static uint16_t _ReadData(void)
+{
+    uint16_t data;
+    if (_index != REG_GRAM)
+        return _reg[_index];
+    if (_readDummy)
+    {
+        _readDummy = 0;
+        return 0;
+    }
+    data = (uint16_t)_ReadByte() << 8;
+    data |= _ReadByte();
+    return data;
+}
+
+
+/**
+ * @brief   Run the pending asynchronous write, reading its buffer now
+ */
+static void _AsyncComplete(void)
+{
+    uint16_t *pData = _async.pData;
+    unsigned int count = _async.count;
+    void (*pfDone)(void) = _async.pfDone;
+    if (pData == NULL)
+        return;
+    _async.pData = NULL;
+    while (count--)
+        _WriteData(*pData++);
+    if (pfDone)
+        pfDone();
+}
+
+
+/**
+ * @brief   Called by bus functions, the bus must be idle
+ * @note    The GPIO routines do not wait for a background transfer, a
+ *          pending one is completed first and counted as a conflict.
+ */
+static inline void _CheckBus(void)
+{
+    if (_async.pData)
+    {
+        ++_async.conflicts;
+        _AsyncComplete();
+    }
+}
+
+
+/*===========================================================================*/
+/* Public Functions                                                          */
+/*===========================================================================*/
+
+
+/**
+ * @brief   Power-on reset: clear registers and GRAM
+ */
+void lcdSimReset(void)
+{
+    memset(_reg, 0, sizeof(_reg));
+    memset(_gram, 0, sizeof(_gram));
+    // Power-on window covers whole GRAM
+    _reg[0x04] = (HX8352C_SIM_GRAM_XSIZE - 1) >> 8;
+    _reg[0x05] = (HX8352C_SIM_GRAM_XSIZE - 1) & 0xFF;
+    _reg[0x08] = (HX8352C_SIM_GRAM_YSIZE - 1) >> 8;
+    _reg[0x09] = (HX8352C_SIM_GRAM_YSIZE - 1) & 0xFF;
+    _index = 0;
+    _col = 0;
+    _row = 0;
+    _readDummy = 0;
+    _readCount = 0;
+    _async.pData = NULL;
+    _async.conflicts = 0;
+}
+
+
+/**
+ * @brief   Select register (RS = 0)
+ * @note    Selecting R22h loads the address counter from the window start.
+ */
+void lcdSimWriteReg(uint16_t data)
+{
+    _CheckBus();
+    ++_pStat->regWrites;
+    _pStat->ns += SIM_NS_WRITE_SINGLE;
+    _SelectReg(data);
+}
+
+
+/**
+ * @brief   Write register or GRAM (RS = 1)
+ */
+void lcdSimWriteData(uint16_t data)
+{
+    _CheckBus();
+    ++_pStat->dataWrites;
+    _pStat->ns += SIM_NS_WRITE_SINGLE;
+    _WriteData(data);
+}
+
+
+/**
+ * @brief   Write a list of register/value pairs
+ */
+void lcdSimWriteRegSequence(const uint16_t *pPairs, unsigned int count)
+{
+    _CheckBus();
+    _pStat->regWrites += count;
+    _pStat->dataWrites += count;
+    _pStat->ns += SIM_NS_WRITE_SEQUENCE + (unsigned long long)count * SIM_NS_WRITE_SEQUENCE_PAIR;
+    while (count--)
+    {
+        _SelectReg(*pPairs++);
+        _WriteData(*pPairs++);
+    }
+}
+
+
+/**
+ * @brief   Write same data multiple times
+ */
+void lcdSimWriteRepeatingData(uint16_t data, unsigned int count)
+{
+    _CheckBus();
+    _pStat->dataWrites += count;
+    _pStat->ns += SIM_NS_WRITE_REPEATING + (unsigned long long)count * SIM_NS_WRITE_REPEATING_WORD;
+    while (count--)
+        _WriteData(data);
+}
+
+
+/**
+ * @brief   Write data buffer
+ */
+void lcdSimWriteMultipleData(uint16_t *pData, unsigned int count)
+{
+    unsigned int head, tail;
+    _CheckBus();
+    head = (count && ((uintptr_t)pData & 2)) ? 1 : 0;
+    tail = (count - head) & 7;
+    _pStat->dataWrites += count;
+    _pStat->ns += SIM_NS_WRITE_MULTIPLE
+        + (unsigned long long)(count - head - tail) * SIM_NS_WRITE_MULTIPLE_WORD
+        + (unsigned long long)(head + tail) * SIM_NS_WRITE_MULTIPLE_TAIL;
+    while (count--)
+        _WriteData(*pData++);
+}
+
+
+/**
+ * @brief   Write 8-bit indexed data buffer through palette
+ */
+void lcdSimWriteMultipleDataLUT(const uint8_t *pIndex, const LCD_PIXELINDEX *pLUT, unsigned int count)
+{
+    _CheckBus();
+    _pStat->dataWrites += count;
+    _pStat->ns += SIM_NS_WRITE_LUT + (unsigned long long)count * SIM_NS_WRITE_LUT_WORD;
+    while (count--)
+        _WriteData((uint16_t)pLUT[*pIndex++]);
+}
+
+
+/**
+ * @brief   Expand packed pixels through palette
+ */
+static void _WritePacked(const uint8_t *pData, unsigned int bpp, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+{
+    unsigned int bit;
+    _CheckBus();
+    _pStat->dataWrites += count;
+    _pStat->ns += SIM_NS_WRITE_PACKED + (unsigned long long)count * SIM_NS_WRITE_PACKED_WORD;
+    for (bit = diff * bpp; count--; bit += bpp)
+        _WriteData((uint16_t)pLUT[(pData[bit / 8] >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1)]);
+}
+
+
+/**
+ * @brief   Write a row of 2bpp packed pixels through palette
+ */
+void lcdSimWriteMultipleData2BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+{
+    _WritePacked(pData, 2, diff, count, pLUT);
+}
+
+
+/**
+ * @brief   Write a row of 4bpp packed pixels through palette
+ */
+void lcdSimWriteMultipleData4BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+{
+    _WritePacked(pData, 4, diff, count, pLUT);
+}
+
+
+/**
+ * @brief   Write data buffer in background
+ * @note    Like lcdWriteMultipleDataAsync(), waits for the previous transfer
+ *          first. The transfer completes at once, or at lcdSimWaitIdle() if
+ *          deferred by lcdSimDeferAsync(), and then calls pfDone.
+ */
+void lcdSimWriteMultipleDataAsync(uint16_t *pData, unsigned int count, void (*pfDone)(void))
+{
+    _AsyncComplete();
+    _pStat->dataWrites += count;
+    _pStat->ns += SIM_NS_WRITE_ASYNC + (unsigned long long)count * SIM_NS_WRITE_ASYNC_WORD;
+    _async.pData = pData;
+    _async.count = count;
+    _async.pfDone = pfDone;
+    if (!_async.defer)
+        _AsyncComplete();
+}
+
+
+/**
+ * @brief   Check if a background write is in progress
+ */
+int lcdSimIsBusy(void)
+{
+    return _async.pData != NULL;
+}
+
+
+/**
+ * @brief   Wait for background write, completes a deferred transfer
+ */
+void lcdSimWaitIdle(void)
+{
+    _AsyncComplete();
+}
+
+
+/**
+ * @brief   Hold asynchronous writes until lcdSimWaitIdle()
+ * @note    The buffer is read when the transfer completes, so changing it
+ *          while the transfer is pending shows up in GRAM as it would with DMA.
+ * @param   defer   Non-zero to hold transfers, 0 to complete them at once
+ */
+void lcdSimDeferAsync(int defer)
+{
+    _async.defer = defer;
+    if (!defer)
+        _AsyncComplete();
+}
+
+
+/**
+ * @brief   Get number of bus accesses made while an asynchronous write was pending
+ * @note    Cleared by lcdSimReset().
+ */
+unsigned long lcdSimGetAsyncConflicts(void)
+{
+    return _async.conflicts;
+}
+
+
+/**
+ * @brief   Read register selected by lcdSimWriteReg()
+ */
+uint16_t lcdSimReadReg(void)
+{
+    _CheckBus();
+    ++_pStat->dataReads;
+    _pStat->ns += SIM_NS_READ_REG;
+    return _reg[_index];
+}
+
+
+/**
+ * @brief   Read GRAM (or register) data
+ * @note    First word after selecting R22h is a dummy, then every word carries
+ *          two 6-bit color components, each left aligned in one byte.
+ */
+uint16_t lcdSimReadData(void)
+{
+    _CheckBus();
+    ++_pStat->dataReads;
+    _pStat->ns += SIM_NS_READ_SINGLE;
+    return _ReadData();
+}
+
+
+/**
+ * @brief   Read multiple 16-bit data
+ */
+void lcdSimReadMultipleData(uint16_t *pData, unsigned int count)
+{
+    _CheckBus();
+    _pStat->dataReads += count;
+    _pStat->ns += SIM_NS_READ_MULTIPLE + (unsigned long long)count * SIM_NS_READ_MULTIPLE_WORD;
+    while (count--)
+        *pData++ = _ReadData();
+}
+
+
+/**
+ * @brief   Read GRAM pixels as RGB565, including dummy read
+ * @note    Charged as lcdSimReadMultipleData() of the same number of words,
+ *          unpacking is done in RD "H" time.
+ */
+void lcdSimReadPixels565(uint16_t *pData, unsigned int count)
+{
+    uint16_t read[3];
+    unsigned int words;
+    _CheckBus();
+    words = 1 + count / 2 * 3 + (count & 1) * 2;
+    _pStat->dataReads += words;
+    _pStat->ns += SIM_NS_READ_MULTIPLE + (unsigned long long)words * SIM_NS_READ_MULTIPLE_WORD;
+    _ReadData();    // Dummy read
+    while (count > 1)
+    {
+        read[0] = _ReadData();
+        read[1] = _ReadData();
+        read[2] = _ReadData();
+        *pData++ = (read[0] & 0xF800) | ((read[0] & 0x00FC) << 3) | (read[1] >> 11);
+        *pData++ = ((read[1] & 0x00F8) << 8) | ((read[2] & 0xFC00) >> 5) | ((read[2] & 0x00F8) >> 3);
+        count -= 2;
+    }
+    if (count)
+    {
+        read[0] = _ReadData();
+        read[1] = _ReadData();
+        *pData = (read[0] & 0xF800) | ((read[0] & 0x00FC) << 3) | (read[1] >> 11);
+    }
+}
+
+
+/**
+ * @brief   Get register value
+ */
+uint16_t lcdSimGetReg(uint8_t reg)
+{
+    return _reg[reg];
+}
+
+
+/**
+ * @brief   Get GRAM pixel (RGB565) at physical location
+ */
+uint16_t lcdSimGetPixel(unsigned int x, unsigned int y)
+{
+    if ((x >= HX8352C_SIM_GRAM_XSIZE) || (y >= HX8352C_SIM_GRAM_YSIZE))
+        return 0;
+    return _gram[y][x];
+}
+
+
+/**
+ * @brief   Get pixel shown on panel line y, after vertical scrolling
+ * @note    MX, MY and MV of R16h only steer the address counter (see _Map()),
+ *          a mirrored scroll axis is already mirrored in GRAM. The panel
+ *          scans its 400 lines from the bottom if ML is set. Lines inside the
+ *          scroll area (R0Eh-R13h) show the GRAM line offset by the scroll
+ *          start pointer (R14h-R15h), wrapping inside the area.
+ */
+uint16_t lcdSimGetScreenPixel(unsigned int x, unsigned int y)
+{
+    unsigned int tfa, vsa, vsp;
+    if (y >= HX8352C_SIM_SCREEN_YSIZE)
+        return 0;
+    if (_reg[REG_MAC] & MAC_ML)
+        y = HX8352C_SIM_SCREEN_YSIZE - 1 - y;
+    tfa = _RegPair(0x0E);
+    vsa = _RegPair(0x10);
+    vsp = _RegPair(0x14);
+    if ((vsa != 0) && (y >= tfa) && (y < tfa + vsa))
+        y = tfa + (y - tfa + vsp - tfa) % vsa;
+    return lcdSimGetPixel(x, y);
+}
+
+
+/**
+ * @brief   Set GRAM pixel (RGB565) at physical location, bypassing the bus
+ */
+void lcdSimSetPixel(unsigned int x, unsigned int y, uint16_t color)
+{
+    if ((x < HX8352C_SIM_GRAM_XSIZE) && (y < HX8352C_SIM_GRAM_YSIZE))
+        _gram[y][x] = color;
+}
+
+
+/**
+ * @brief   Charge following bus traffic to a named section
+ * @param   name    Section name, a static string (compared by content)
+ * @return  Previously active section name, to be passed to lcdSimEndSection()
+ */
+const char *lcdSimBeginSection(const char *name)
+{
+    const char *prev = _pStat->name;
+    int i;
+    for (i = 0; i < _numStat; ++i)
+    {
+        if (strcmp(_stat[i].name, name) == 0)
+            break;
+    }
+    if (i == _numStat)
+    {
+        if (_numStat == SIM_MAX_SECTIONS)
+            i = 0;  // Table full, charge to "(other)"
+        else
+            _stat[_numStat++].name = name;
+    }
+    _pStat = &_stat[i];
+    ++_pStat->calls;
+    return prev;
+}
+
+
+/**
+ * @brief   Return to the section active before lcdSimBeginSection()
+ * @param   prev    Value returned by lcdSimBeginSection()
+ */
+void lcdSimEndSection(const char *prev)
+{
+    int i;
+    for (i = 0; i < _numStat; ++i)
+    {
+        if (_stat[i].name == prev)
+            break;
+    }
+    _pStat = (i < _numStat) ? &_stat[i] : &_stat[0];
+}
+
+
+/**
+ * @brief   Clear all accounting sections
+ */
+void lcdSimResetStat(void)
+{
+    memset(_stat, 0, sizeof(_stat));
+    _stat[0].name = "(other)";
+    _numStat = 1;
+    _pStat = &_stat[0];
+}
+
+
+/**
+ * @brief   Get accounting section
+ * @param   index   Section index, 0 is traffic outside any section
+ * @return  Section statistics, NULL if index is out of range
+ */
+const HX8352C_SIM_STAT *lcdSimGetStat(int index)
+{
+    if ((index < 0) || (index >= _numStat))
+        return NULL;
+    return &_stat[index];
+}
+
+
+/**
+ * @brief   Print bus usage of every section to stdout
+ */
+void lcdSimPrintStat(void)
+{
+    HX8352C_SIM_STAT total = { .name = "Total" };
+    int i;
+    printf("%-24s %10s %10s %10s %10s %12s\n", "Section", "Calls", "RegWr", "DataWr", "DataRd", "Bus us");
+    for (i = 0; i <= _numStat; ++i)
+    {
+        const HX8352C_SIM_STAT *p = (i < _numStat) ? &_stat[i] : &total;
+        if (i < _numStat)
+        {
+            if ((p->regWrites | p->dataWrites | p->dataReads | p->calls) == 0)
+                continue;
+            total.calls += p->calls;
+            total.regWrites += p->regWrites;
+            total.dataWrites += p->dataWrites;
+            total.dataReads += p->dataReads;
+            total.ns += p->ns;
+        }
+        printf("%-24s %10lu %10lu %10lu %10lu %12.1f\n", p->name, p->calls,
+               p->regWrites, p->dataWrites, p->dataReads, p->ns / 1000.0);
+    }
+}
+
+
+/*************************** End of file ****************************/
@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    HX8352C_Sim.h
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Host-side HX8352C bus simulator
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   The lcdSimXxx() bus functions have the same signatures as the
+  *         lcdXxx() functions in HX8352C.h, so a host build of LCD_X_Config()
+  *         can hand them to GUIDRV_HX8352C_SetFunc() in place of the
+  *         GPIO routines.
+  ******************************************************************************
+  */
+
+#ifndef HX8352C_SIM_H
+#define HX8352C_SIM_H
+
+#include <stdint.h>
+#include "GUI.h"
+#include "GUIDRV_HX8352C.h"
+
+//! GRAM columns
+#define HX8352C_SIM_GRAM_XSIZE  240
+//! GRAM rows (only the first 400 rows reach the panel)
+#define HX8352C_SIM_GRAM_YSIZE  432
+//! Panel lines
+#define HX8352C_SIM_SCREEN_YSIZE    400
+
+/**
+ * @brief   Bus usage charged to one accounting section
+ */
+typedef struct _HX8352C_SIM_STAT
+{
+    //! Section name
+    const char *name;
+    //! Number of times the section was entered
+    unsigned long calls;
+    //! Register index writes (RS = 0)
+    unsigned long regWrites;
+    //! Data words written (RS = 1), both register values and GRAM
+    unsigned long dataWrites;
+    //! Data words read, including dummy reads
+    unsigned long dataReads;
+    //! Estimated bus time in ns on the STM32F103 @ 72MHz GPIO interface
+    unsigned long long ns;
+} HX8352C_SIM_STAT;
+
+
+// Bus functions, replacement of HX8352C.h low level functions
+
+//! @fn  void lcdSimWriteData(uint16_t data)
+void lcdSimWriteData(uint16_t data);
+//! @fn  void lcdSimWriteReg(uint16_t data)
+void lcdSimWriteReg(uint16_t data);
+//! @fn  void lcdSimWriteRegSequence(const uint16_t *pPairs, unsigned int count)
+void lcdSimWriteRegSequence(const uint16_t *pPairs, unsigned int count);
+//! @fn  void lcdSimWriteRepeatingData(uint16_t data, unsigned int count)
+void lcdSimWriteRepeatingData(uint16_t data, unsigned int count);
+//! @fn  void lcdSimWriteMultipleData(uint16_t *pData, unsigned int count)
+void lcdSimWriteMultipleData(uint16_t *pData, unsigned int count);
+//! @fn  void lcdSimWriteMultipleDataLUT(const uint8_t *pIndex, const LCD_PIXELINDEX *pLUT, unsigned int count)
+void lcdSimWriteMultipleDataLUT(const uint8_t *pIndex, const LCD_PIXELINDEX *pLUT, unsigned int count);
+//! @fn  void lcdSimWriteMultipleData2BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+void lcdSimWriteMultipleData2BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT);
+//! @fn  void lcdSimWriteMultipleData4BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+void lcdSimWriteMultipleData4BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT);
+//! @fn uint16_t lcdSimReadData(void)
+uint16_t lcdSimReadData(void);
+//! @fn void lcdSimWriteMultipleDataAsync(uint16_t *pData, unsigned int count, void (*pfDone)(void))
+void lcdSimWriteMultipleDataAsync(uint16_t *pData, unsigned int count, void (*pfDone)(void));
+//! @fn int lcdSimIsBusy(void)
+int lcdSimIsBusy(void);
+//! @fn void lcdSimWaitIdle(void)
+void lcdSimWaitIdle(void);
+//! @fn uint16_t lcdSimReadReg(void)
+uint16_t lcdSimReadReg(void);
+//! @fn void lcdSimReadMultipleData(uint16_t *pData, unsigned int count)
+void lcdSimReadMultipleData(uint16_t *pData, unsigned int count);
+//! @fn void lcdSimReadPixels565(uint16_t *pData, unsigned int count)
+void lcdSimReadPixels565(uint16_t *pData, unsigned int count);
+
+// Simulator control and inspection
+
+//! @fn void lcdSimReset(void)
+void lcdSimReset(void);
+//! @fn uint16_t lcdSimGetReg(uint8_t reg)
+uint16_t lcdSimGetReg(uint8_t reg);
+//! @fn uint16_t lcdSimGetPixel(unsigned int x, unsigned int y)
+uint16_t lcdSimGetPixel(unsigned int x, unsigned int y);
+//! @fn uint16_t lcdSimGetScreenPixel(unsigned int x, unsigned int y)
+uint16_t lcdSimGetScreenPixel(unsigned int x, unsigned int y);
+//! @fn void lcdSimSetPixel(unsigned int x, unsigned int y, uint16_t color)
+void lcdSimSetPixel(unsigned int x, unsigned int y, uint16_t color);
+//! @fn void lcdSimDeferAsync(int defer)
+void lcdSimDeferAsync(int defer);
+//! @fn unsigned long lcdSimGetAsyncConflicts(void)
+unsigned long lcdSimGetAsyncConflicts(void);
+
+// Bus cost accounting
+
+//! @fn const char *lcdSimBeginSection(const char *name)
+const char *lcdSimBeginSection(const char *name);
+//! @fn void lcdSimEndSection(const char *prev)
+void lcdSimEndSection(const char *prev);
+//! @fn void lcdSimResetStat(void)
+void lcdSimResetStat(void);
+//! @fn const HX8352C_SIM_STAT *lcdSimGetStat(int index)
+const HX8352C_SIM_STAT *lcdSimGetStat(int index);
+//! @fn void lcdSimPrintStat(void)
+void lcdSimPrintStat(void);
+
+
+// Host configuration, see LCDConf_Sim.c
+
+//! @fn void LCD_X_GetSimAPI(HX8352C_HW_API *pAPI)
+void LCD_X_GetSimAPI(HX8352C_HW_API *pAPI);
+
+//! Profiling wrapper of GUIDRV_HX8352C_API, see GUIDRV_HX8352C_Prof.c
+extern const GUI_DEVICE_API GUIDRV_HX8352C_PROF_API;
+
+#endif // HX8352C_SIM_H
@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file    LCDConf.h
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   emWin LCD driver layer configuration for the host simulator
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   Found before inc/LCDConf.h in the host build. The checks run in
+  *         normal rotation, where logical coordinates are GRAM coordinates.
+  ******************************************************************************
+  */
+
+#ifndef LCDCONF_H
+#define LCDCONF_H
+
+/**
+ * @name    Configuration for panel rotation
+ * @{
+ */
+
+//! Swap X-Y axis
+#define LCD_SWAP_XY 0
+
+//! Mirror X axis (before swapping)
+#define LCD_MIRROR_X 0
+
+//! Mirror Y axis (before swapping)
+#define LCD_MIRROR_Y 0
+
+/* @} */
+
+#endif // LCDCONF_H
+
+/*************************** End of file ****************************/
@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file    LCDConf_Sim.c
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   emWin LCD driver layer configuration for the host simulator
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   Same as src/LCDConf.c, with the lcdSimXxx() bus functions in place
+  *         of the GPIO routines and the profiling wrapper of the driver.
+  ******************************************************************************
+  */
+
+#include "GUI.h"
+#include "GUIDRV_HX8352C.h"
+#include "HX8352C_Sim.h"
+
+
+/*===========================================================================*/
+/* Public Functions                                                          */
+/*===========================================================================*/
+
+/**
+ * @brief   Fill a hardware access table with the simulator bus functions
+ * @param   pAPI    Table to fill
+ */
+void LCD_X_GetSimAPI(HX8352C_HW_API *pAPI)
+{
+    pAPI->pfWriteReg = lcdSimWriteReg;
+    pAPI->pfWriteData = lcdSimWriteData;
+    pAPI->pfWriteRegSequence = lcdSimWriteRegSequence;
+    pAPI->pfWriteRepeatingData = lcdSimWriteRepeatingData;
+    pAPI->pfWriteMultipleData = lcdSimWriteMultipleData;
+    pAPI->pfWriteMultipleDataLUT = lcdSimWriteMultipleDataLUT;
+    pAPI->pfWriteMultipleData2BPP = lcdSimWriteMultipleData2BPP;
+    pAPI->pfWriteMultipleData4BPP = lcdSimWriteMultipleData4BPP;
+    pAPI->pfReadReg = lcdSimReadReg;
+    pAPI->pfReadData = lcdSimReadData;
+    pAPI->pfReadMultipleData = lcdSimReadMultipleData;
+    pAPI->pfReadPixels565 = lcdSimReadPixels565;
+    pAPI->pfWriteMultipleDataAsync = lcdSimWriteMultipleDataAsync;
+    pAPI->pfWaitIdle = lcdSimWaitIdle;
+}
+
+
+/**
+ * @brief   Display driver configuration
+ */
+void LCD_X_Config(void)
+{
+    GUI_DEVICE *pDevice;
+    HX8352C_HW_API hwAPI = {0};
+
+    // Set display driver and color conversion, bus traffic is charged per primitive
+    pDevice = GUI_DEVICE_CreateAndLink(&GUIDRV_HX8352C_PROF_API, GUICC_565, 0, 0);
+    // Port access functions
+    LCD_X_GetSimAPI(&hwAPI);
+    // Give driver access to the functions
+    GUIDRV_HX8352C_SetFunc(pDevice, &hwAPI);
+}
+
+
+/**
+ * @brief   Command handler for display driver
+ * @param   layerIndex  Index of the driver (layer) which generates the command
+ * @param   cmd         Command code
+ * @param   pData       Command specific data
+ * @return  Command process result
+ * @retval  0   Command handled
+ * @retval  -1  Command not handled
+ */
+int LCD_X_DisplayDriver(unsigned layerIndex, unsigned cmd, void *pData)
+{
+    int r = -1;
+
+    GUI_USE_PARA(pData);
+    if (layerIndex == 0)    // Only first controller is handled
+    {
+        switch (cmd)
+        {
+        case LCD_X_INITCONTROLLER:
+            lcdSimReset();
+            r = 0;
+            break;
+        case LCD_X_ON:
+        case LCD_X_OFF:
+            r = 0;
+            break;
+        }
+    }
+    return r;
+}
+
+
+/*************************** End of file ****************************/
@@ -0,0 +1,251 @@
+/**
+  ******************************************************************************
+  * @file    GUI.h
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Minimal emWin API subset for the host build of GUIDRV_HX8352C
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  * @note   Only the types, constants and functions referenced by the driver
+  *         and the host check are declared. Names and signatures follow
+  *         STemWin 5.22, U32 is unsigned long as in emWin's Global.h. The
+  *         functions are implemented by GUI_Stub.c.
+  ******************************************************************************
+  */
+
+#ifndef GUI_H
+#define GUI_H
+
+#include <stddef.h>
+
+
+/*===========================================================================*/
+/* Basic types                                                               */
+/*===========================================================================*/
+
+// emWin uses long for 32 bits, int keeps U32 (and LCD_PIXELINDEX) 4 bytes
+// wide on 64-bit hosts as on the target
+#define U8  unsigned char
+#define U16 unsigned short
+#define U32 unsigned int
+#define I8  signed char
+#define I16 signed short
+#define I32 signed int
+
+#define LCD_PIXELINDEX  U32
+#define LCD_COLOR       U32
+#define GUI_COLOR       U32
+
+#define GUI_UNI_PTR
+
+// Provided by CMSIS on target
+#ifndef __PACKED
+#define __PACKED __attribute__((packed))
+#endif
+
+#define GUI_USE_PARA(para)  (void)para
+#define GUI_COUNTOF(a)      (sizeof(a) / sizeof(a[0]))
+
+typedef I32 GUI_HMEM;
+
+typedef struct
+{
+    I16 x0, y0, x1, y1;
+} GUI_RECT;
+
+typedef GUI_RECT LCD_RECT;
+
+typedef void GUI_CALLBACK_VOID_P(void *p);
+
+typedef struct
+{
+    int NumEntries;
+    char HasTrans;
+    const LCD_COLOR *pPalEntries;
+} LCD_LOGPALETTE;
+
+typedef LCD_LOGPALETTE GUI_LOGPALETTE;
+
+
+/*===========================================================================*/
+/* Color conversion                                                          */
+/*===========================================================================*/
+
+typedef LCD_PIXELINDEX tLCDDEV_Color2Index(LCD_COLOR Color);
+typedef LCD_COLOR tLCDDEV_Index2Color(LCD_PIXELINDEX Index);
+typedef LCD_PIXELINDEX tLCDDEV_GetIndexMask(void);
+
+typedef struct
+{
+    tLCDDEV_Color2Index *pfColor2Index;
+    tLCDDEV_Index2Color *pfIndex2Color;
+    tLCDDEV_GetIndexMask *pfGetIndexMask;
+    int NoAlpha;
+} LCD_API_COLOR_CONV;
+
+extern const LCD_API_COLOR_CONV LCD_API_ColorConv_565;
+#define GUICC_565 &LCD_API_ColorConv_565
+
+
+/*===========================================================================*/
+/* Devices                                                                   */
+/*===========================================================================*/
+
+typedef struct GUI_DEVICE GUI_DEVICE;
+typedef struct GUI_DEVICE_API GUI_DEVICE_API;
+
+struct GUI_DEVICE_API
+{
+    int DeviceClassIndex;
+    void (*pfDrawBitmap)(GUI_DEVICE *pDevice, int x0, int y0, int xsize, int ysize, int BitsPerPixel, int BytesPerLine, const U8 GUI_UNI_PTR *pData, int Diff, const LCD_PIXELINDEX *pTrans);
+    void (*pfDrawHLine)(GUI_DEVICE *pDevice, int x0, int y0, int x1);
+    void (*pfDrawVLine)(GUI_DEVICE *pDevice, int x, int y0, int y1);
+    void (*pfFillRect)(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1);
+    unsigned (*pfGetPixelIndex)(GUI_DEVICE *pDevice, int x, int y);
+    void (*pfSetPixelIndex)(GUI_DEVICE *pDevice, int x, int y, int ColorIndex);
+    void (*pfXorPixel)(GUI_DEVICE *pDevice, int x, int y);
+    void (*pfSetOrg)(GUI_DEVICE *pDevice, int x, int y);
+    void (*(*pfGetDevFunc)(GUI_DEVICE **ppDevice, int Index))(void);
+    I32 (*pfGetDevProp)(GUI_DEVICE *pDevice, int Index);
+    void *(*pfGetDevData)(GUI_DEVICE *pDevice, int Index);
+    void (*pfGetRect)(GUI_DEVICE *pDevice, LCD_RECT *pRect);
+};
+
+struct GUI_DEVICE
+{
+    GUI_DEVICE *pNext;
+    GUI_DEVICE *pPrev;
+    union
+    {
+        GUI_HMEM hContext;
+        void *pContext;
+    } u;
+    const GUI_DEVICE_API *pDeviceAPI;
+    const LCD_API_COLOR_CONV *pColorConvAPI;
+    U16 Flags;
+    int LayerIndex;
+};
+
+#define DEVICE_CLASS_DRIVER 0
+
+GUI_DEVICE *GUI_DEVICE_CreateAndLink(const GUI_DEVICE_API *pDeviceAPI, const LCD_API_COLOR_CONV *pColorConvAPI, U16 Flags, int LayerIndex);
+
+
+/*===========================================================================*/
+/* Bitmaps                                                                   */
+/*===========================================================================*/
+
+typedef struct
+{
+    int Dummy;
+} GUI_BITMAP_METHODS;
+
+typedef struct
+{
+    U16 XSize;
+    U16 YSize;
+    U16 BytesPerLine;
+    U16 BitsPerPixel;
+    const U8 GUI_UNI_PTR *pData;
+    const GUI_LOGPALETTE GUI_UNI_PTR *pPal;
+    const GUI_BITMAP_METHODS *pMethods;
+} GUI_BITMAP;
+
+extern const GUI_BITMAP_METHODS GUI_BitmapMethods565;
+#define GUI_DRAW_BMP565 &GUI_BitmapMethods565
+
+
+/*===========================================================================*/
+/* Memory devices                                                            */
+/*===========================================================================*/
+
+#define GUI_SUPPORT_MEMDEV  1
+
+typedef GUI_HMEM GUI_MEMDEV_Handle;
+
+#define GUI_MEMDEV_NOTRANS  (1 << 0)
+
+extern const GUI_DEVICE_API GUI_MEMDEV_DEVICE_16;
+#define GUI_MEMDEV_APILIST_16 &GUI_MEMDEV_DEVICE_16
+
+GUI_MEMDEV_Handle GUI_MEMDEV_CreateFixed(int x0, int y0, int xSize, int ySize, int Flags, const GUI_DEVICE_API *pDeviceAPI, const LCD_API_COLOR_CONV *pColorConvAPI);
+void GUI_MEMDEV_Delete(GUI_MEMDEV_Handle hMem);
+GUI_MEMDEV_Handle GUI_MEMDEV_Select(GUI_MEMDEV_Handle hMem);
+GUI_MEMDEV_Handle GUI_MEMDEV_GetSelMemdev(void);
+void GUI_MEMDEV_SetOrg(GUI_MEMDEV_Handle hMem, int x0, int y0);
+void GUI_MEMDEV_ReduceYSize(GUI_MEMDEV_Handle hMem, int YSize);
+void GUI_MEMDEV_CopyToLCD(GUI_MEMDEV_Handle hMem);
+void *GUI_MEMDEV_GetDataPtr(GUI_MEMDEV_Handle hMem);
+int GUI_MEMDEV_GetXSize(GUI_MEMDEV_Handle hMem);
+int GUI_MEMDEV_GetYSize(GUI_MEMDEV_Handle hMem);
+
+
+/*===========================================================================*/
+/* LCD layer                                                                 */
+/*===========================================================================*/
+
+/**
+ * @{
+ * Device capabilities, pfGetDevProp() index
+ */
+#define LCD_DEVCAP_XSIZE        0x01
+#define LCD_DEVCAP_YSIZE        0x02
+#define LCD_DEVCAP_VXSIZE       0x03
+#define LCD_DEVCAP_VYSIZE       0x04
+#define LCD_DEVCAP_XORG         0x05
+#define LCD_DEVCAP_YORG         0x06
+#define LCD_DEVCAP_CONTROLLER   0x07
+#define LCD_DEVCAP_BITSPERPIXEL 0x08
+#define LCD_DEVCAP_NUMCOLORS    0x09
+#define LCD_DEVCAP_XMAG         0x0A
+#define LCD_DEVCAP_YMAG         0x0B
+#define LCD_DEVCAP_MIRROR_X     0x0C
+#define LCD_DEVCAP_MIRROR_Y     0x0D
+#define LCD_DEVCAP_SWAP_XY      0x0E
+#define LCD_DEVCAP_SWAP_RB      0x0F
+/** @} */
+
+/**
+ * @{
+ * Device functions, pfGetDevFunc() index
+ */
+#define LCD_DEVFUNC_READRECT        0x01
+#define LCD_DEVFUNC_SETVRAMADDR     0x02
+#define LCD_DEVFUNC_SET_VSIZE       0x03
+#define LCD_DEVFUNC_SET_SIZE        0x04
+#define LCD_DEVFUNC_INIT            0x05
+#define LCD_DEVFUNC_ON              0x06
+#define LCD_DEVFUNC_OFF             0x07
+#define LCD_DEVFUNC_COPYRECT        0x08
+#define LCD_DEVFUNC_DRAWBMP_16BPP   0x09
+/** @} */
+
+//! Device data, pfGetDevData() index
+#define LCD_DEVDATA_MEMDEV  0x01
+
+#define LCD_X_INITCONTROLLER    0x01
+#define LCD_X_ON                0x05
+#define LCD_X_OFF               0x06
+
+void LCD_X_Config(void);
+int LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void *pData);
+
+int LCD_Init(void);
+int LCD_SetVSizeEx(int LayerIndex, int xSize, int ySize);
+void LCD_SetClipRectMax(void);
+const LCD_PIXELINDEX *LCD_GetpPalConvTable(const LCD_LOGPALETTE GUI_UNI_PTR *pLogPal);
+
+int GUI_Init(void);
+void GUI_SetOrg(int x, int y);
+
+
+#endif // GUI_H
@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    GUI_Private.h
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Minimal emWin context for the host build of GUIDRV_HX8352C
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef GUI_PRIVATE_H
+#define GUI_PRIVATE_H
+
+#include "GUI.h"
+#include "LCD_Private.h"
+
+
+/**
+ * @{
+ * Draw modes
+ */
+typedef int LCD_DRAWMODE;
+#define LCD_DRAWMODE_NORMAL (0)
+#define LCD_DRAWMODE_XOR    (1 << 0)
+#define LCD_DRAWMODE_TRANS  (1 << 1)
+/** @} */
+
+
+/**
+ * @brief   Drawing context, only the members used by the driver
+ */
+typedef struct
+{
+    LCD_RECT ClipRect;
+    LCD_DRAWMODE DrawMode;
+    int SelLayer;
+    LCD_PIXELINDEX *LCD_pColorIndex;
+    LCD_PIXELINDEX aColorIndex[2];
+    int xOff, yOff;
+} GUI_CONTEXT;
+
+extern GUI_CONTEXT *GUI_pContext;
+
+#define LCD__GetColorIndex() (*GUI_pContext->LCD_pColorIndex)
+
+GUI_DEVICE *GUI_DEVICE__GetpDriver(int LayerIndex);
+
+void *GUI_ALLOC_GetFixedBlock(int Size);
+void *GUI_ALLOC_LockH(GUI_HMEM hMem);
+void GUI_ALLOC_UnlockH(void **pp);
+
+
+#endif // GUI_PRIVATE_H
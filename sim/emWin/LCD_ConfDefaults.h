@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    LCD_ConfDefaults.h
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Pulls in LCDConf.h for the host build of GUIDRV_HX8352C
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef LCD_CONFDEFAULTS_H
+#define LCD_CONFDEFAULTS_H
+
+#include "LCDConf.h"
+
+#endif // LCD_CONFDEFAULTS_H
@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file    LCD_Private.h
+  * @author  Baoshi
+  * @version 0.1
+  * @date    16-Oct-2026
+  * @brief   Minimal emWin driver interface for the host build of GUIDRV_HX8352C
+  ******************************************************************************
+  * @copyright
+  * This code is licensed under (CC BY-SA 3.0), available at:
+  *
+  *     http://creativecommons.org/licenses/by-sa/3.0/
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHORS BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef LCD_PRIVATE_H
+#define LCD_PRIVATE_H
+
+#include "GUI.h"
+
+
+//! Bits per pixel of an index mask
+int LCD__GetBPP(LCD_PIXELINDEX IndexMask);
+
+
+#endif // LCD_PRIVATE_H
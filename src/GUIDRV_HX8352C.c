@@ -49,55 +49,42 @@
 /** @} */
 
 
+//! GRAM lines along the gate (vertical scroll) axis, YSIZE_PHYS of them are visible
+#define VSIZE_PHYS 432
+
+
+//! Pixel pairs (3 bus words each) read per pfReadMultipleData burst in _ReadPixels565
+#define READ_BURST_PAIRS 32
+
+
+//! Pixels expanded per pfWriteMultipleData call in _DrawIndexedSpan
+#define SPAN_BUFFER_SIZE 64
+
+
+//! Pixels read back, XORed and written per window in _XorRect
+#define XOR_BUFFER_SIZE 64
+
+
+//! Pixels read back and written per window in _CopyBlock
+#define COPY_BUFFER_SIZE 128
+
+
+//! Pixels blended per span in _DrawBitmap32BPP
+#define ALPHA_BUFFER_SIZE 64
+
+
+//! Pixels converted per burst in _DrawBitmap24BPP
+#define CONV_BUFFER_SIZE 64
+
+
 /**
  * @{
- * Macros to handle MIRROR_, SWAP_ combinations
- */
-#if (!LCD_MIRROR_X && !LCD_MIRROR_Y && !LCD_SWAP_XY)
-    // Rotate 0
-    #define LCD_XSIZE XSIZE_PHYS
-    #define LCD_YSIZE YSIZE_PHYS
-    #define LOG2PHYS_X(x, y) x
-    #define LOG2PHYS_Y(x, y) y
-#elif (!LCD_MIRROR_X && !LCD_MIRROR_Y && LCD_SWAP_XY)
-    #define LCD_XSIZE YSIZE_PHYS
-    #define LCD_YSIZE XSIZE_PHYS
-    #define LOG2PHYS_X(x, y) x
-    #define LOG2PHYS_Y(x, y) y
-#elif (!LCD_MIRROR_X && LCD_MIRROR_Y && !LCD_SWAP_XY)
-    #define LCD_XSIZE XSIZE_PHYS
-    #define LCD_YSIZE YSIZE_PHYS
-    #define LOG2PHYS_X(x, y) x
-    #define LOG2PHYS_Y(x, y) 32 + (y)
-#elif (!LCD_MIRROR_X && LCD_MIRROR_Y && LCD_SWAP_XY)
-    // Rotate 270
-    #define LCD_XSIZE YSIZE_PHYS
-    #define LCD_YSIZE XSIZE_PHYS
-    #define LOG2PHYS_X(x, y) 32 + (x)
-    #define LOG2PHYS_Y(x, y) y
-#elif (LCD_MIRROR_X && !LCD_MIRROR_Y && !LCD_SWAP_XY)
-    #define LCD_XSIZE XSIZE_PHYS
-    #define LCD_YSIZE YSIZE_PHYS
-    #define LOG2PHYS_X(x, y) x
-    #define LOG2PHYS_Y(x, y) y
-#elif (LCD_MIRROR_X && !LCD_MIRROR_Y && LCD_SWAP_XY)
-    // Rotate 90
-    #define LCD_XSIZE YSIZE_PHYS
-    #define LCD_YSIZE XSIZE_PHYS
-    #define LOG2PHYS_X(x, y) x
-    #define LOG2PHYS_Y(x, y) y
-#elif (LCD_MIRROR_X && LCD_MIRROR_Y && !LCD_SWAP_XY)
-    // Rotate 180
-    #define LCD_XSIZE XSIZE_PHYS
-    #define LCD_YSIZE YSIZE_PHYS
-    #define LOG2PHYS_X(x, y) x
-    #define LOG2PHYS_Y(x, y) 32 + (y)
-#elif (LCD_MIRROR_X &&  LCD_MIRROR_Y &&  LCD_SWAP_XY)
-    #define LCD_XSIZE YSIZE_PHYS
-    #define LCD_YSIZE XSIZE_PHYS
-    #define LOG2PHYS_X(x, y) 32 + (x)
-    #define LOG2PHYS_Y(x, y) y
-#endif
+ * Logical to GRAM coordinates. Mirroring and swapping are done by the
+ * controller (R16h), only the scroll axis needs an offset which depends on
+ * the orientation and is set up by _SetGeometry().
+ */
+#define LOG2PHYS_X(x, y) ((x) + pContext->xOff)
+#define LOG2PHYS_Y(x, y) ((y) + pContext->yOff)
 /** @} */
 
 
@@ -133,29 +120,260 @@ typedef struct _DRIVER_CONTEXT
 {
     //! Hardware clip rectangle depends on screen rotation
     LCD_RECT hwClip;  // hardware clip rectangle
+    //! Last values written to R02h-R09h, valid if winValid is set
+    LCD_RECT hwWin;
+    //! Non-zero if hwWin matches the controller
+    int winValid;
+    //! Current orientation, R16h bits HX8352C_SWAP_XY, HX8352C_MIRROR_X, HX8352C_MIRROR_Y
+    U16 orientation;
+    //! Logical screen width in current orientation
+    I16 xSize;
+    //! Logical screen height in current orientation
+    I16 ySize;
+    //! Added to logical X to get GRAM column
+    I16 xOff;
+    //! Added to logical Y to get GRAM row
+    I16 yOff;
+    //! GRAM line of logical line 0 along the scroll axis
+    I16 scrollBase;
+    //! Virtual screen size along the scroll axis
+    I16 vSize;
+    //! Origin along the scroll axis set by _SetOrg()
+    I16 scrollOrg;
+    //! Non-zero once _Init() has programmed the scroll area
+    int scrollOn;
+    //! Non-zero once _Init() has initialized the controller
+    int initDone;
     // LCD access functions
     //! Write 16-bit data to LCD (RS = 0)
     void (*pfWriteReg)(U16 data);
     //! Write 16-bit data to LCD (RS = 1)
     void (*pfWriteData)(U16 data);
+    //! Write list of register/value pairs to LCD
+    void (*pfWriteRegSequence)(const U16 *pPairs, unsigned int count);
     //! Write data buffer to LCD (RS = 0)
     void (*pfWriteMultipleData)(U16 *pData, unsigned int count);
     //! Write same data to LCD multiple times (RS = 0)
     void (*pfWriteRepeatingData)(U16 data, unsigned int count);
+    //! Write 8-bit indexed data buffer through palette (RS = 0), optional
+    void (*pfWriteMultipleDataLUT)(const U8 *pIndex, const LCD_PIXELINDEX *pLUT, unsigned int count);
+    //! Write a row of 2bpp packed pixels through palette (RS = 0), optional
+    void (*pfWriteMultipleData2BPP)(const U8 *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT);
+    //! Write a row of 4bpp packed pixels through palette (RS = 0), optional
+    void (*pfWriteMultipleData4BPP)(const U8 *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT);
     //! Read Register from LCD (RS = 1)
     U16 (*pfReadReg)(void);
     //! Read GRAM from LCD (RS = 1)
     U16 (*pfReadData)(void);
     //! Read multiple 16-bit data from LCD GRAM (RS = 1)
     void (*pfReadMultipleData)(U16 *pData, unsigned int count);
+    //! Read GRAM pixels as RGB565, including dummy read (RS = 1)
+    void (*pfReadPixels565)(U16 *pData, unsigned int count);
+    //! Write data buffer to LCD in background (RS = 1)
+    void (*pfWriteMultipleDataAsync)(U16 *pData, unsigned int count, void (*pfDone)(void));
+    //! Wait until background write completes
+    void (*pfWaitIdle)(void);
+    //! Non-zero while GUIDRV_HX8352C_MEMDEV_Draw() flushes a band
+    int asyncFlush;
+    //! Number of background writes started, compared with _asyncDone
+    U32 asyncSeq;
 } DRIVER_CONTEXT;
 
 
+/*===========================================================================*/
+/* Static Data                                                               */
+/*===========================================================================*/
+
+//! Number of background writes completed, counted by _AsyncDone()
+static volatile U32 _asyncDone;
+
+
 /*===========================================================================*/
 /* Static Functions                                                          */
 /*===========================================================================*/
 
 
+/**
+ * @brief   Completion callback of pfWriteMultipleDataAsync, may run in interrupt
+ */
+static void _AsyncDone(void)
+{
+    ++_asyncDone;
+}
+
+
+/**
+ * @brief   Wait until a background write has completed
+ * @note    Only one background write runs at a time, so if it has not
+ *          completed it is the one running.
+ * @param   pContext    Driver context
+ * @param   seq         Value of asyncSeq after the write was started
+ */
+static void _WaitAsync(DRIVER_CONTEXT *pContext, U32 seq)
+{
+    if ((I32)(_asyncDone - seq) < 0)
+        pContext->pfWaitIdle();
+}
+
+
+/**
+ * @brief   Write a list of register/value pairs
+ * @note    Falls back to pfWriteReg/pfWriteData if pfWriteRegSequence is not set.
+ * @param   pContext    Driver context
+ * @param   pPairs      Register/value pairs
+ * @param   count       Number of pairs
+ */
+static void _WriteRegSequence(DRIVER_CONTEXT *pContext, const U16 *pPairs, unsigned int count)
+{
+    if (pContext->pfWriteRegSequence)
+    {
+        pContext->pfWriteRegSequence(pPairs, count);
+        return;
+    }
+    while (count--)
+    {
+        pContext->pfWriteReg(*pPairs++);
+        pContext->pfWriteData(*pPairs++);
+    }
+}
+
+
+/**
+ * @brief   Read GRAM pixels as RGB565, including dummy read
+ * @note    Falls back to pfReadMultipleData and repacking in C if
+ *          pfReadPixels565 is not set.
+ * @param   pContext    Driver context
+ * @param   pData       Buffer for the pixels
+ * @param   count       Number of pixels
+ */
+static void _ReadPixels565(DRIVER_CONTEXT *pContext, U16 *pData, unsigned int count)
+{
+    U16 read[1 + READ_BURST_PAIRS * 3];
+    U16 *pRead;
+    unsigned int pairs;
+    int dummy;
+
+    if (pContext->pfReadPixels565)
+    {
+        pContext->pfReadPixels565(pData, count);
+        return;
+    }
+    // Read in bursts, the first burst also carries the dummy read into read[0]
+    dummy = 1;
+    while (count > 1)
+    {
+        pairs = count >> 1;
+        if (pairs > READ_BURST_PAIRS)
+            pairs = READ_BURST_PAIRS;
+        pContext->pfReadMultipleData(read + 1 - dummy, pairs * 3 + dummy);
+        dummy = 0;
+        count -= pairs << 1;
+        pRead = read + 1;
+        while (pairs--)
+        {
+            *pData++ = (pRead[0] & 0xF800) | ((pRead[0] & 0x00FC) << 3) | (pRead[1] >> 11);
+            *pData++ = ((pRead[1] & 0x00F8) << 8) | ((pRead[2] & 0xFC00) >> 5) | ((pRead[2] & 0x00F8) >> 3);
+            pRead += 3;
+        }
+    }
+    if (count)  // count == 1
+    {
+        pContext->pfReadMultipleData(read + 1 - dummy, 2 + dummy);
+        *pData = (read[1] & 0xF800) | ((read[1] & 0x00FC) << 3) | (read[2] >> 11);
+    }
+}
+
+
+/**
+ * @brief   Forget the cached window so the next _SetWindow() writes all registers
+ * @param   pContext    Driver context
+ */
+static inline void _InvalidateWindow(DRIVER_CONTEXT *pContext)
+{
+    pContext->winValid = 0;
+}
+
+
+/**
+ * @brief   Queue a window register pair (high byte at reg, low byte at reg + 1)
+ * @note    Only the bytes that differ from the cached value are queued,
+ *          both bytes are queued if the cache is not valid.
+ * @param   pPairs      Next free entry of the register/value list
+ * @param   reg         Register holding the high byte
+ * @param   pCache      Cached value of the register pair, updated on return
+ * @param   value       Value to program
+ * @param   valid       Non-zero if *pCache matches the controller
+ * @return  Next free entry of the register/value list
+ */
+static inline U16 * _QueueWindowReg(U16 *pPairs, U16 reg, I16 *pCache, U16 value, int valid)
+{
+    U16 cache = (U16)*pCache;
+    if (!valid || (HIBYTE(cache) != HIBYTE(value)))
+    {
+        *pPairs++ = reg;
+        *pPairs++ = HIBYTE(value);
+    }
+    if (!valid || (LOBYTE(cache) != LOBYTE(value)))
+    {
+        *pPairs++ = reg + 1;
+        *pPairs++ = LOBYTE(value);
+    }
+    *pCache = (I16)value;
+    return pPairs;
+}
+
+
+/**
+ * @brief   Set GRAM window (R02h-R09h), physical coordinates
+ * @note    Writing R22h reloads the address counter from the window start,
+ *          so registers already holding the right value are not rewritten.
+ * @param   pContext    Driver context
+ * @param   x0      Column start
+ * @param   y0      Row start
+ * @param   x1      Column end
+ * @param   y1      Row end
+ */
+static void _SetWindow(DRIVER_CONTEXT *pContext, U16 x0, U16 y0, U16 x1, U16 y1)
+{
+    U16 pairs[16], *p = pairs;
+    int valid = pContext->winValid;
+    p = _QueueWindowReg(p, 0x0002, &pContext->hwWin.x0, x0, valid);
+    p = _QueueWindowReg(p, 0x0004, &pContext->hwWin.x1, x1, valid);
+    p = _QueueWindowReg(p, 0x0006, &pContext->hwWin.y0, y0, valid);
+    p = _QueueWindowReg(p, 0x0008, &pContext->hwWin.y1, y1, valid);
+    pContext->winValid = 1;
+    if (p != pairs)
+        _WriteRegSequence(pContext, pairs, (p - pairs) / 2);
+}
+
+
+/**
+ * @brief   Move GRAM cursor (window start), physical coordinates
+ * @note    Block primitives leave their window behind. The window end is only
+ *          restored to the hardware clip when it no longer covers the cursor,
+ *          so back-to-back block primitives never pay for the restore.
+ * @param   pContext    Driver context
+ * @param   x       Column
+ * @param   y       Row
+ */
+static inline void _SetCursor(DRIVER_CONTEXT *pContext, U16 x, U16 y)
+{
+    U16 pairs[16], *p = pairs;
+    int valid = pContext->winValid;
+    if (!valid || (pContext->hwWin.x1 < (I16)x) || (pContext->hwWin.y1 < (I16)y))
+    {
+        // Window is dirty or unknown, restore column/row end
+        p = _QueueWindowReg(p, 0x0004, &pContext->hwWin.x1, pContext->hwClip.x1, valid);
+        p = _QueueWindowReg(p, 0x0008, &pContext->hwWin.y1, pContext->hwClip.y1, valid);
+    }
+    p = _QueueWindowReg(p, 0x0002, &pContext->hwWin.x0, x, valid);
+    p = _QueueWindowReg(p, 0x0006, &pContext->hwWin.y0, y, valid);
+    pContext->winValid = 1;
+    if (p != pairs)
+        _WriteRegSequence(pContext, pairs, (p - pairs) / 2);
+}
+
+
 /**
  * @brief   Set the index (color) of a pixel
  * @note    Caller ensures the coordinates are in range.
@@ -167,34 +385,16 @@ typedef struct _DRIVER_CONTEXT
 static void _SetPixelIndex(GUI_DEVICE *pDevice, int x, int y, int color)
 {
     DRIVER_CONTEXT *pContext;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     // Convert coordinates
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
     U16 xphys, yphys;
     xphys = LOG2PHYS_X(x, y);
     yphys = LOG2PHYS_Y(x, y);
-#else
-    //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-    #define xphys ((U16)x)
-    #define yphys ((U16)y)
-    //! @endcond
-#endif
-    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     // Move cursor
-    pContext->pfWriteReg(0x0002);
-    pContext->pfWriteData(HIBYTE(xphys));
-    pContext->pfWriteReg(0x0003);
-    pContext->pfWriteData(LOBYTE(xphys));
-    pContext->pfWriteReg(0x0006);
-    pContext->pfWriteData(HIBYTE(yphys));
-    pContext->pfWriteReg(0x0007);
-    pContext->pfWriteData(LOBYTE(yphys));
+    _SetCursor(pContext, xphys, yphys);
     // Write data
     pContext->pfWriteReg(0x0022);
     pContext->pfWriteData(color);
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-    #undef xphys
-    #undef yphys
-#endif
 }
 
 
@@ -209,38 +409,17 @@ static void _SetPixelIndex(GUI_DEVICE *pDevice, int x, int y, int color)
 static unsigned int _GetPixelIndex(GUI_DEVICE *pDevice, int x, int y)
 {
     DRIVER_CONTEXT *pContext;
-    U16 reads[3];
-    unsigned int color;
+    U16 color;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     // Convert coordinates
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
     U16 xphys, yphys;
     xphys = LOG2PHYS_X(x, y);
     yphys = LOG2PHYS_Y(x, y);
-#else
-    //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-    #define xphys ((U16)x)
-    #define yphys ((U16)y)
-    //! @endcond
-#endif
-    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     // Move cursor
-    pContext->pfWriteReg(0x0002);
-    pContext->pfWriteData(HIBYTE(xphys));
-    pContext->pfWriteReg(0x0003);
-    pContext->pfWriteData(LOBYTE(xphys));
-    pContext->pfWriteReg(0x0006);
-    pContext->pfWriteData(HIBYTE(yphys));
-    pContext->pfWriteReg(0x0007);
-    pContext->pfWriteData(LOBYTE(yphys));
+    _SetCursor(pContext, xphys, yphys);
     // Start read data
     pContext->pfWriteReg(0x0022);
-    pContext->pfReadMultipleData(reads, 3);
-    // Pack RGB
-    color = ((reads[1] & 0xF800) | ((reads[1] & 0x00FC) << 3) | (reads[2] >> 11));
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-    #undef xphys
-    #undef yphys
-#endif
+    _ReadPixels565(pContext, &color, 1);
     return color;
 }
 
@@ -262,6 +441,272 @@ static void _XorPixel(GUI_DEVICE *pDevice, int x, int y)
 }
 
 
+/**
+ * @brief   XOR a rectangle with color mask
+ * @note    The rectangle is processed in windows of up to XOR_BUFFER_SIZE
+ *          pixels, each read back in one burst, XORed in RAM and written back
+ *          to the same window.
+ * @param   pDevice Device context
+ * @param   x0      Starting X coordinate
+ * @param   y0      Starting Y coordinate
+ * @param   x1      Ending X coordinate
+ * @param   y1      Ending Y coordinate
+ */
+static void _XorRect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1)
+{
+    DRIVER_CONTEXT *pContext;
+    U16 buffer[XOR_BUFFER_SIZE];
+    U16 mask;
+    int x, y, xEnd, yEnd;
+    int cols, rows, count, i;
+
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    mask = (U16)pDevice->pColorConvAPI->pfGetIndexMask();
+    cols = x1 - x0 + 1;
+    rows = 1;
+    if (cols > XOR_BUFFER_SIZE)
+        cols = XOR_BUFFER_SIZE;
+    else
+        rows = XOR_BUFFER_SIZE / cols;
+    for (y = y0; y <= y1; y += rows)
+    {
+        yEnd = y + rows - 1;
+        if (yEnd > y1)
+            yEnd = y1;
+        for (x = x0; x <= x1; x += cols)
+        {
+            xEnd = x + cols - 1;
+            if (xEnd > x1)
+                xEnd = x1;
+            count = (xEnd - x + 1) * (yEnd - y + 1);
+            _SetWindow(pContext, LOG2PHYS_X(x, y), LOG2PHYS_Y(x, y), LOG2PHYS_X(xEnd, yEnd), LOG2PHYS_Y(xEnd, yEnd));
+            // Read back, writing R22h again restarts from window start
+            pContext->pfWriteReg(0x0022);
+            _ReadPixels565(pContext, buffer, count);
+            for (i = 0; i < count; ++i)
+                buffer[i] ^= mask;
+            pContext->pfWriteReg(0x0022);
+            pContext->pfWriteMultipleData(buffer, count);
+        }
+    }
+}
+
+
+/**
+ * @brief   Copy a rectangle of GRAM to another position
+ * @note    The rectangle is processed in windows of up to COPY_BUFFER_SIZE
+ *          pixels, each read back in one burst into a stack buffer and
+ *          written to the destination window. Windows are taken from the
+ *          side the rectangle moves to, so overlapping source lines are read
+ *          before they are overwritten.
+ * @param   pContext    Driver context
+ * @param   xSrc    Source X coordinate
+ * @param   ySrc    Source Y coordinate
+ * @param   xDst    Destination X coordinate
+ * @param   yDst    Destination Y coordinate
+ * @param   xSize   Width of the rectangle
+ * @param   ySize   Height of the rectangle
+ */
+static void _CopyBlock(DRIVER_CONTEXT *pContext, int xSrc, int ySrc, int xDst, int yDst, int xSize, int ySize)
+{
+    U16 buffer[COPY_BUFFER_SIZE];
+    int x, y, xEnd, yEnd;
+    int cols, rows, count, i, j;
+    int dx, dy;
+
+    dx = xDst - xSrc;
+    dy = yDst - ySrc;
+    cols = xSize;
+    rows = 1;
+    if (cols > COPY_BUFFER_SIZE)
+        cols = COPY_BUFFER_SIZE;
+    else
+        rows = COPY_BUFFER_SIZE / cols;
+    for (i = 0; i < ySize; i += rows)
+    {
+        if (dy > 0)
+        {
+            // Moving down, start from the bottom
+            yEnd = ySrc + ySize - 1 - i;
+            y = yEnd - rows + 1;
+            if (y < ySrc)
+                y = ySrc;
+        }
+        else
+        {
+            y = ySrc + i;
+            yEnd = y + rows - 1;
+            if (yEnd > ySrc + ySize - 1)
+                yEnd = ySrc + ySize - 1;
+        }
+        for (j = 0; j < xSize; j += cols)
+        {
+            if ((dy == 0) && (dx > 0))
+            {
+                // Moving right within the same lines, start from the right
+                xEnd = xSrc + xSize - 1 - j;
+                x = xEnd - cols + 1;
+                if (x < xSrc)
+                    x = xSrc;
+            }
+            else
+            {
+                x = xSrc + j;
+                xEnd = x + cols - 1;
+                if (xEnd > xSrc + xSize - 1)
+                    xEnd = xSrc + xSize - 1;
+            }
+            count = (xEnd - x + 1) * (yEnd - y + 1);
+            _SetWindow(pContext, LOG2PHYS_X(x, y), LOG2PHYS_Y(x, y), LOG2PHYS_X(xEnd, yEnd), LOG2PHYS_Y(xEnd, yEnd));
+            pContext->pfWriteReg(0x0022);
+            _ReadPixels565(pContext, buffer, count);
+            _SetWindow(pContext, LOG2PHYS_X(x + dx, y + dy), LOG2PHYS_Y(x + dx, y + dy), LOG2PHYS_X(xEnd + dx, yEnd + dy), LOG2PHYS_Y(xEnd + dx, yEnd + dy));
+            pContext->pfWriteReg(0x0022);
+            pContext->pfWriteMultipleData(buffer, count);
+        }
+    }
+}
+
+
+/**
+ * @brief   Open a one line GRAM window for block writing
+ * @param   pContext    Driver context
+ * @param   x0      Starting X coordinate
+ * @param   y       Y coordinate
+ * @param   x1      Ending X coordinate
+ */
+static void _OpenSpan(DRIVER_CONTEXT *pContext, int x0, int y, int x1)
+{
+    U16 x0phys, x1phys, yphys;
+    x0phys = LOG2PHYS_X(x0, y);
+    x1phys = LOG2PHYS_X(x1, y);
+    yphys = LOG2PHYS_Y(x0, y);
+    // Set window
+    _SetWindow(pContext, x0phys, yphys, x1phys, yphys);
+    pContext->pfWriteReg(0x0022);
+}
+
+
+/**
+ * @brief   Fill a horizontal span with given color using block writing
+ * @param   pDevice Device context
+ * @param   x0      Starting X coordinate
+ * @param   y       Y coordinate
+ * @param   x1      Ending X coordinate
+ * @param   color   Color (or index) of the span
+ */
+static void _FillSpan(GUI_DEVICE *pDevice, int x0, int y, int x1, LCD_PIXELINDEX color)
+{
+    DRIVER_CONTEXT *pContext;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    _OpenSpan(pContext, x0, y, x1);
+    pContext->pfWriteRepeatingData(color, x1 - x0 + 1);
+}
+
+
+/**
+ * @brief   Draw a span of 2/4/8bpp indexed pixels found in a bitmap row
+ * @note    Spans longer than one pixel are written as one block, through the
+ *          palette expansion hooks when available. Otherwise the pixels are
+ *          expanded into a stack buffer and written by pfWriteMultipleData.
+ * @param   pDevice Device context
+ * @param   x0      Starting X coordinate
+ * @param   y       Y coordinate
+ * @param   x1      Ending X coordinate
+ * @param   pData   Bitmap byte holding the first pixel of the span
+ * @param   pixel   Position of the first pixel in that byte, 0 is most significant
+ * @param   bpp     Bits per pixel, 2, 4 or 8
+ * @param   pTrans  Palette, or NULL if pixels are color indexes already
+ */
+static void _DrawIndexedSpan(GUI_DEVICE *pDevice, int x0, int y, int x1, const U8 GUI_UNI_PTR *pData, int pixel, int bpp, const LCD_PIXELINDEX *pTrans)
+{
+    DRIVER_CONTEXT *pContext;
+    U16 buffer[SPAN_BUFFER_SIZE];
+    int count, shift, index, ppb, mask, n, i;
+
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    count = x1 - x0 + 1;
+    ppb = 8 / bpp;
+    mask = (1 << bpp) - 1;
+    if (count == 1)
+    {
+        index = (*pData >> (8 - bpp - pixel * bpp)) & mask;
+        _SetPixelIndex(pDevice, x0, y, pTrans ? pTrans[index] : (LCD_PIXELINDEX)index);
+        return;
+    }
+    _OpenSpan(pContext, x0, y, x1);
+    if (pTrans)
+    {
+        if ((bpp == 8) && pContext->pfWriteMultipleDataLUT)
+        {
+            pContext->pfWriteMultipleDataLUT(pData, pTrans, count);
+            return;
+        }
+        if ((bpp == 4) && pContext->pfWriteMultipleData4BPP)
+        {
+            pContext->pfWriteMultipleData4BPP(pData, pixel, count, pTrans);
+            return;
+        }
+        if ((bpp == 2) && pContext->pfWriteMultipleData2BPP)
+        {
+            pContext->pfWriteMultipleData2BPP(pData, pixel, count, pTrans);
+            return;
+        }
+    }
+    while (count)
+    {
+        n = (count > SPAN_BUFFER_SIZE) ? SPAN_BUFFER_SIZE : count;
+        for (i = 0; i < n; ++i)
+        {
+            shift = 8 - bpp - pixel * bpp;
+            index = (*pData >> shift) & mask;
+            buffer[i] = (U16)(pTrans ? pTrans[index] : (LCD_PIXELINDEX)index);
+            if (++pixel == ppb)
+            {
+                pixel = 0;
+                ++pData;
+            }
+        }
+        pContext->pfWriteMultipleData(buffer, n);
+        count -= n;
+    }
+}
+
+
+/**
+ * @brief   Draw a run of same colored pixels found in a bitmap row
+ * @note    Isolated pixels are cheaper through _SetPixelIndex, longer runs
+ *          are written as one block.
+ * @param   pDevice Device context
+ * @param   x0      Starting X coordinate
+ * @param   y       Y coordinate
+ * @param   x1      Ending X coordinate
+ * @param   color   Color (or index) of the run
+ */
+static inline void _DrawRun(GUI_DEVICE *pDevice, int x0, int y, int x1, LCD_PIXELINDEX color)
+{
+    if (x0 == x1)
+        _SetPixelIndex(pDevice, x0, y, color);
+    else
+        _FillSpan(pDevice, x0, y, x1, color);
+}
+
+
+/**
+ * @brief   Write a run of same colored pixels into current GRAM window
+ * @param   pContext    Driver context
+ * @param   color       Color (or index) of the run
+ * @param   count       Number of pixels, can be 0
+ */
+static inline void _WriteRun(DRIVER_CONTEXT *pContext, LCD_PIXELINDEX color, int count)
+{
+    if (count > 1)
+        pContext->pfWriteRepeatingData((U16)color, count);
+    else if (count == 1)
+        pContext->pfWriteData((U16)color);
+}
+
+
 /**
  * @brief   Draw a horizontal line using selected color
  * @param   pDevice Device context
@@ -271,19 +716,17 @@ static void _XorPixel(GUI_DEVICE *pDevice, int x, int y)
  */
 static void _DrawHLine(GUI_DEVICE *pDevice, int x0, int y,  int x1)
 {
-    DRIVER_CONTEXT *pContext;
     LCD_PIXELINDEX color;
 
     if (GUI_pContext->DrawMode & LCD_DRAWMODE_XOR)
     {
-        for (; x0 <= x1; ++x0)
-            _XorPixel(pDevice, x0, y);
+        _XorRect(pDevice, x0, y, x1, y);
     }
     else
     {
         color = LCD__GetColorIndex();
-        // Draw horizontal line using "block writing" method takes (25 + length) writing operations.
-        // Draw the same line using _SetPixelIndex takes 10 * length writing operations.
+        // Draw horizontal line using "block writing" method takes up to (17 + length) writing operations.
+        // Draw the same line using _SetPixelIndex takes up to 10 * length writing operations.
         // So we use block writing only when (length >= 3)
         if (x1 - x0 < 3)
         {
@@ -292,56 +735,7 @@ static void _DrawHLine(GUI_DEVICE *pDevice, int x0, int y,  int x1)
         }
         else
         {
-            pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
-            U16 x0phys, x1phys, yphys;
-            x0phys = LOG2PHYS_X(x0, y);
-            x1phys = LOG2PHYS_X(x1, y);
-            yphys = LOG2PHYS_Y(x0, y);
-#else
-            //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-            #define x0phys ((U16)x0)
-            #define x1phys ((U16)x1)
-            #define yphys ((U16)y)
-            //! @endcond
-#endif
-            // Set column start
-            pContext->pfWriteReg(0x0002);
-            pContext->pfWriteData(HIBYTE(x0phys));
-            pContext->pfWriteReg(0x0003);
-            pContext->pfWriteData(LOBYTE(x0phys));
-            // Set column end
-            pContext->pfWriteReg(0x0004);
-            pContext->pfWriteData(HIBYTE(x1phys));
-            pContext->pfWriteReg(0x0005);
-            pContext->pfWriteData(LOBYTE(x1phys));
-            // Set row start
-            pContext->pfWriteReg(0x0006);
-            pContext->pfWriteData(HIBYTE(yphys));
-            pContext->pfWriteReg(0x0007);
-            pContext->pfWriteData(LOBYTE(yphys));
-            // Set row end
-            pContext->pfWriteReg(0x0008);
-            pContext->pfWriteData(HIBYTE(yphys));
-            pContext->pfWriteReg(0x0009);
-            pContext->pfWriteData(LOBYTE(yphys));
-            // Write data
-            pContext->pfWriteReg(0x0022);
-            pContext->pfWriteRepeatingData(color, x1 - x0 + 1);
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-            #undef x0phys
-            #undef x1phys
-            #undef yphys
-#endif
-            // Restore column/row end
-            pContext->pfWriteReg(0x0004);
-            pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-            pContext->pfWriteReg(0x0005);
-            pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-            pContext->pfWriteReg(0x0008);
-            pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-            pContext->pfWriteReg(0x0009);
-            pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
+            _FillSpan(pDevice, x0, y, x1, color);
         }
     }
 }
@@ -361,14 +755,13 @@ static void _DrawVLine(GUI_DEVICE *pDevice, int x, int y0,  int y1)
 
     if (GUI_pContext->DrawMode & LCD_DRAWMODE_XOR)
     {
-        for (; y0 <= y1; ++y0)
-            _XorPixel(pDevice, x, y0);
+        _XorRect(pDevice, x, y0, x, y1);
     }
     else
     {
         color = LCD__GetColorIndex();
-        // Draw vertical line using "block writing" method takes (25 + length) writing operations.
-        // Draw the same line using _SetPixelIndex takes 10 * length writing operations.
+        // Draw vertical line using "block writing" method takes up to (17 + length) writing operations.
+        // Draw the same line using _SetPixelIndex takes up to 10 * length writing operations.
         // So we use block writing only when (length >= 3)
         if (y1 - y0 < 3)
         {
@@ -378,55 +771,15 @@ static void _DrawVLine(GUI_DEVICE *pDevice, int x, int y0,  int y1)
         else
         {
             pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
             U16 xphys, y0phys, y1phys;
             xphys = LOG2PHYS_X(x, y0);
             y0phys = LOG2PHYS_Y(x, y0);
             y1phys = LOG2PHYS_Y(x, y1);
-#else
-            //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-            #define x0phys ((U16)x)
-            #define y0phys ((U16)y0)
-            #define y1phys ((U16)y1)
-            //! @endcond
-#endif
-            // Set column start
-            pContext->pfWriteReg(0x0002);
-            pContext->pfWriteData(HIBYTE(xphys));
-            pContext->pfWriteReg(0x0003);
-            pContext->pfWriteData(LOBYTE(xphys));
-            // Set column end
-            pContext->pfWriteReg(0x0004);
-            pContext->pfWriteData(HIBYTE(xphys));
-            pContext->pfWriteReg(0x0005);
-            pContext->pfWriteData(LOBYTE(xphys));
-            // Set row start
-            pContext->pfWriteReg(0x0006);
-            pContext->pfWriteData(HIBYTE(y0phys));
-            pContext->pfWriteReg(0x0007);
-            pContext->pfWriteData(LOBYTE(y0phys));
-            // Set row end
-            pContext->pfWriteReg(0x0008);
-            pContext->pfWriteData(HIBYTE(y1phys));
-            pContext->pfWriteReg(0x0009);
-            pContext->pfWriteData(LOBYTE(y1phys));
+            // Set window
+            _SetWindow(pContext, xphys, y0phys, xphys, y1phys);
             // Write data
             pContext->pfWriteReg(0x0022);
             pContext->pfWriteRepeatingData(color, y1 - y0 + 1);
-    #if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-            #undef xphys
-            #undef y0phys
-            #undef y1phys
-    #endif
-            // Restore column/row end
-            pContext->pfWriteReg(0x0004);
-            pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-            pContext->pfWriteReg(0x0005);
-            pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-            pContext->pfWriteReg(0x0008);
-            pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-            pContext->pfWriteReg(0x0009);
-            pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
         }
     }
 }
@@ -448,66 +801,23 @@ static void _FillRect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1)
 
     if (GUI_pContext->DrawMode & LCD_DRAWMODE_XOR)
     {
-        for (; y0 <= y1; ++y0)
-            _DrawHLine(pDevice, x0, y0, x1);
+        _XorRect(pDevice, x0, y0, x1, y1);
     }
     else
     {
         index = LCD__GetColorIndex();
         total = (x1 - x0 + 1) * (y1 - y0 + 1);
         pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
         U16 x0phys, x1phys, y0phys, y1phys;
         x0phys = LOG2PHYS_X(x0, y0);
         x1phys = LOG2PHYS_X(x1, y1);
         y0phys = LOG2PHYS_Y(x0, y0);
         y1phys = LOG2PHYS_Y(x1, y1);
-#else
-        //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-        #define x0phys ((U16)x0)
-        #define x1phys ((U16)x1)
-        #define y0phys ((U16)y0)
-        #define y1phys ((U16)y1)
-        //! @endcond
-#endif
-        // Set column start
-        pContext->pfWriteReg(0x0002);
-        pContext->pfWriteData(HIBYTE(x0phys));
-        pContext->pfWriteReg(0x0003);
-        pContext->pfWriteData(LOBYTE(x0phys));
-        // Set column end
-        pContext->pfWriteReg(0x0004);
-        pContext->pfWriteData(HIBYTE(x1phys));
-        pContext->pfWriteReg(0x0005);
-        pContext->pfWriteData(LOBYTE(x1phys));
-        // Set row start
-        pContext->pfWriteReg(0x0006);
-        pContext->pfWriteData(HIBYTE(y0phys));
-        pContext->pfWriteReg(0x0007);
-        pContext->pfWriteData(LOBYTE(y0phys));
-        // Set row end
-        pContext->pfWriteReg(0x0008);
-        pContext->pfWriteData(HIBYTE(y1phys));
-        pContext->pfWriteReg(0x0009);
-        pContext->pfWriteData(LOBYTE(y1phys));
+        // Set window
+        _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
         // Write data
         pContext->pfWriteReg(0x0022);
         pContext->pfWriteRepeatingData(index, total);
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-        #undef x0phys
-        #undef x1phys
-        #undef y0phys
-        #undef y1phys
-#endif
-        // Restore column/row end
-        pContext->pfWriteReg(0x0004);
-        pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-        pContext->pfWriteReg(0x0005);
-        pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-        pContext->pfWriteReg(0x0008);
-        pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-        pContext->pfWriteReg(0x0009);
-        pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
     }
 }
 
@@ -526,10 +836,10 @@ static void _FillRect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1)
  */
 static inline void _DrawBitmap1BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, int width, int height, int stride, const U8 GUI_UNI_PTR *pData, int diff, const LCD_PIXELINDEX *pTrans)
 {
-    LCD_PIXELINDEX index0, index1, pixels;
+    LCD_PIXELINDEX index0, index1, pixels, color, runColor;
     const U8 GUI_UNI_PTR *pTempData;
     int x1, y1;
-    int curPixel;
+    int curPixel, n, run;
     DRIVER_CONTEXT *pContext;
 
     pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
@@ -537,61 +847,50 @@ static inline void _DrawBitmap1BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
     x1 = x0 + width - 1;    // X end
     y1 = y0 + height - 1;   // Y end
 
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
     U16 x0phys, x1phys, y0phys, y1phys;
     x0phys = LOG2PHYS_X(x0, y0);
     x1phys = LOG2PHYS_X(x1, y1);
     y0phys = LOG2PHYS_Y(x0, y0);
     y1phys = LOG2PHYS_Y(x1, y1);
-#else
-    //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-    #define x0phys ((U16)x0)
-    #define x1phys ((U16)x1)
-    #define y0phys ((U16)y0)
-    #define y1phys ((U16)y1)
-    //! @endcond
-#endif
-    // Set column start
-    pContext->pfWriteReg(0x0002);
-    pContext->pfWriteData(HIBYTE(x0phys));
-    pContext->pfWriteReg(0x0003);
-    pContext->pfWriteData(LOBYTE(x0phys));
-    // Set column end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(x1phys));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(x1phys));
-    // Set row start
-    pContext->pfWriteReg(0x0006);
-    pContext->pfWriteData(HIBYTE(y0phys));
-    pContext->pfWriteReg(0x0007);
-    pContext->pfWriteData(LOBYTE(y0phys));
-    // Set row end
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(y1phys));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(y1phys));
+    // Set window
+    _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
 
-    // Write data
+    // Write data, pixels of same color are collected into runs, which may
+    // continue to next line as GRAM address wraps inside the window
     pContext->pfWriteReg(0x0022);
     index0 = *pTrans;
     index1 = *(pTrans + 1);
+    runColor = index0;
+    run = 0;
     for (y0 = 0; y0 < height; ++y0) // reuse x0, y0 here
     {
         curPixel = diff;
         pTempData = pData;
         pixels = *pTempData;
-        for (x0 = 0; x0 < width; ++x0)
+        x0 = width; // Pixels left in this line
+        while (x0 > 0)
         {
-            if (pixels & (0x80 >> curPixel))
+            if ((curPixel == 0) && (x0 >= 8) && ((pixels == 0x00) || (pixels == 0xFF)))
             {
-                pContext->pfWriteData((U16)index1);
+                // Whole byte of same color
+                color = pixels ? index1 : index0;
+                n = 8;
             }
             else
             {
-                pContext->pfWriteData((U16)index0);
+                color = (pixels & (0x80 >> curPixel)) ? index1 : index0;
+                n = 1;
             }
-            if (++curPixel == 8)
+            if (color != runColor)
+            {
+                _WriteRun(pContext, runColor, run);
+                runColor = color;
+                run = 0;
+            }
+            run += n;
+            x0 -= n;
+            curPixel += n;
+            if (curPixel == 8)
             {
                 curPixel = 0;
                 pixels = *(++pTempData);
@@ -599,22 +898,7 @@ static inline void _DrawBitmap1BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
         }
         pData += stride;    // Next line
     }
-
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-    #undef x0phys
-    #undef x1phys
-    #undef y0phys
-    #undef y1phys
-#endif
-    // Restore column/row end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
+    _WriteRun(pContext, runColor, run);
 }
 
 
@@ -635,6 +919,7 @@ static inline void _DrawBitmap1BPPTransparent(GUI_DEVICE *pDevice, int x0, int y
     LCD_PIXELINDEX pixels, index1;
     const U8 GUI_UNI_PTR *pTempData;
     int x1, y1, x, y;
+    int xRun;
     int curPixel;
 
     x0 = x0 + diff; // Adjust starting X coordinate
@@ -646,16 +931,27 @@ static inline void _DrawBitmap1BPPTransparent(GUI_DEVICE *pDevice, int x0, int y
         curPixel = diff;
         pTempData = pData;
         pixels = *pTempData;
+        xRun = -1;  // No run of set bits yet
         for (x = x0; x <= x1; ++x)
         {
             if (pixels & (0x80 >> curPixel))
-                _SetPixelIndex(pDevice, x, y, index1);
+            {
+                if (xRun < 0)
+                    xRun = x;
+            }
+            else if (xRun >= 0)
+            {
+                _DrawRun(pDevice, xRun, y, x - 1, index1);
+                xRun = -1;
+            }
             if (++curPixel == 8)
             {
                curPixel = 0;
                pixels = *(++pTempData);
             }
         }
+        if (xRun >= 0)
+            _DrawRun(pDevice, xRun, y, x1, index1);
         pData += stride;
     }
 }
@@ -762,43 +1058,24 @@ static inline void _DrawBitmap2BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
     x1 = x0 + width - 1;    // X end
     y1 = y0 + height - 1;   // Y end
 
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
     U16 x0phys, x1phys, y0phys, y1phys;
     x0phys = LOG2PHYS_X(x0, y0);
     x1phys = LOG2PHYS_X(x1, y1);
     y0phys = LOG2PHYS_Y(x0, y0);
     y1phys = LOG2PHYS_Y(x1, y1);
-#else
-    //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-    #define x0phys ((U16)x0)
-    #define x1phys ((U16)x1)
-    #define y0phys ((U16)y0)
-    #define y1phys ((U16)y1)
-    //! @endcond
-#endif
-    // Set column start
-    pContext->pfWriteReg(0x0002);
-    pContext->pfWriteData(HIBYTE(x0phys));
-    pContext->pfWriteReg(0x0003);
-    pContext->pfWriteData(LOBYTE(x0phys));
-    // Set column end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(x1phys));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(x1phys));
-    // Set row start
-    pContext->pfWriteReg(0x0006);
-    pContext->pfWriteData(HIBYTE(y0phys));
-    pContext->pfWriteReg(0x0007);
-    pContext->pfWriteData(LOBYTE(y0phys));
-    // Set row end
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(y1phys));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(y1phys));
+    // Set window
+    _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
     // Write data
     pContext->pfWriteReg(0x0022);
-    if (pTrans)
+    if (pTrans && pContext->pfWriteMultipleData2BPP)
+    {
+        for (y0 = 0; y0 < height; ++y0) // reuse y0 here
+        {
+            pContext->pfWriteMultipleData2BPP(pData, diff, width, pTrans);
+            pData += stride;    // Next line
+        }
+    }
+    else if (pTrans)
     {
         for (y0 = 0; y0 < height; ++y0) // reuse x0, y0 here
         {
@@ -840,21 +1117,6 @@ static inline void _DrawBitmap2BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
             pData += stride;    // Next line
         }
     }
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-    #undef x0phys
-    #undef x1phys
-    #undef y0phys
-    #undef y1phys
-#endif
-    // Restore column/row end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
 }
 
 
@@ -874,55 +1136,49 @@ static inline void _DrawBitmap2BPPTransparent(GUI_DEVICE *pDevice, int x0, int y
 {
     LCD_PIXELINDEX pixels;
     const U8 GUI_UNI_PTR *pTempData;
+    const U8 GUI_UNI_PTR *pSpanData;
     int x1, y1, x, y;
     int curPixel, shift, index;
+    int xSpan, spanPixel;
 
     x0 = x0 + diff; // Adjust starting X coordinate
     x1 = x0 + width - 1;    // X end
     y1 = y0 + height - 1;   // Y end
-    if (pTrans)
+    pSpanData = pData;
+    spanPixel = 0;
+    for (y = y0; y <= y1; ++y)
     {
-        for (y = y0; y <= y1; ++y)
+        curPixel = diff;
+        pTempData = pData;
+        pixels = *pTempData;
+        xSpan = -1; // No opaque span yet
+        for (x = x0; x <= x1; ++x)
         {
-            curPixel = diff;
-            pTempData = pData;
-            pixels = *pTempData;
-            for (x = x0; x <= x1; ++x)
+            shift = (3 - curPixel) << 1;
+            index = (pixels & (0xC0 >> (6 - shift))) >> shift;
+            if (index)
             {
-                shift = (3 - curPixel) << 1;
-                index = (pixels & (0xC0 >> (6 - shift))) >> shift;
-                if (index)
-                    _SetPixelIndex(pDevice, x, y, pTrans[index]);
-                if (++curPixel == 4)
+                if (xSpan < 0)
                 {
-                    curPixel = 0;
-                    pixels = *(++pTempData);
+                    xSpan = x;
+                    pSpanData = pTempData;
+                    spanPixel = curPixel;
                 }
             }
-            pData += stride;
-        }
-    }
-    else
-    {
-        for (y = y0; y <= y1; ++y)
-        {
-            curPixel = diff;
-            pTempData = pData;
-            pixels = *pTempData;
-            for (x = x0; x <= x1; ++x)
+            else if (xSpan >= 0)
             {
-                shift = (3 - curPixel) << 1;
-                index = (pixels & (0xC0 >> (6 - shift))) >> shift;
-                if (index)
-                    _SetPixelIndex(pDevice, x, y, index);
-                if (++curPixel == 4)
-               {
-                   curPixel = 0;
-                   pixels = *(++pTempData);
-               }
+                _DrawIndexedSpan(pDevice, xSpan, y, x - 1, pSpanData, spanPixel, 2, pTrans);
+                xSpan = -1;
+            }
+            if (++curPixel == 4)
+            {
+                curPixel = 0;
+                pixels = *(++pTempData);
             }
-            pData += stride;
         }
+        if (xSpan >= 0)
+            _DrawIndexedSpan(pDevice, xSpan, y, x1, pSpanData, spanPixel, 2, pTrans);
+        pData += stride;
     }
 }
 
@@ -979,43 +1235,24 @@ static inline void _DrawBitmap4BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
     x1 = x0 + width - 1;    // X end
     y1 = y0 + height - 1;   // Y end
 
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
     U16 x0phys, x1phys, y0phys, y1phys;
     x0phys = LOG2PHYS_X(x0, y0);
     x1phys = LOG2PHYS_X(x1, y1);
     y0phys = LOG2PHYS_Y(x0, y0);
     y1phys = LOG2PHYS_Y(x1, y1);
-#else
-    //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-    #define x0phys ((U16)x0)
-    #define x1phys ((U16)x1)
-    #define y0phys ((U16)y0)
-    #define y1phys ((U16)y1)
-    //! @endcond
-#endif
-    // Set column start
-    pContext->pfWriteReg(0x0002);
-    pContext->pfWriteData(HIBYTE(x0phys));
-    pContext->pfWriteReg(0x0003);
-    pContext->pfWriteData(LOBYTE(x0phys));
-    // Set column end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(x1phys));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(x1phys));
-    // Set row start
-    pContext->pfWriteReg(0x0006);
-    pContext->pfWriteData(HIBYTE(y0phys));
-    pContext->pfWriteReg(0x0007);
-    pContext->pfWriteData(LOBYTE(y0phys));
-    // Set row end
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(y1phys));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(y1phys));
+    // Set window
+    _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
     // Write data
     pContext->pfWriteReg(0x0022);
-    if (pTrans)
+    if (pTrans && pContext->pfWriteMultipleData4BPP)
+    {
+        for (y0 = 0; y0 < height; ++y0) // reuse y0 here
+        {
+            pContext->pfWriteMultipleData4BPP(pData, diff, width, pTrans);
+            pData += stride;    // Next line
+        }
+    }
+    else if (pTrans)
     {
         for (y0 = 0; y0 < height; ++y0) // reuse x0, y0 here
         {
@@ -1057,21 +1294,6 @@ static inline void _DrawBitmap4BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
             pData += stride;    // Next line
         }
     }
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-    #undef x0phys
-    #undef x1phys
-    #undef y0phys
-    #undef y1phys
-#endif
-    // Restore column/row end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
 }
 
 
@@ -1091,55 +1313,49 @@ static inline void _DrawBitmap4BPPTransparent(GUI_DEVICE *pDevice, int x0, int y
 {
     LCD_PIXELINDEX pixels;
     const U8 GUI_UNI_PTR *pTempData;
+    const U8 GUI_UNI_PTR *pSpanData;
     int x1, y1, x, y;
     int curPixel, shift, index;
+    int xSpan, spanPixel;
 
     x0 = x0 + diff; // Adjust starting X coordinate
     x1 = x0 + width - 1;    // X end
     y1 = y0 + height - 1;   // Y end
-    if (pTrans)
+    pSpanData = pData;
+    spanPixel = 0;
+    for (y = y0; y <= y1; ++y)
     {
-        for (y = y0; y <= y1; ++y)
+        curPixel = diff;
+        pTempData = pData;
+        pixels = *pTempData;
+        xSpan = -1; // No opaque span yet
+        for (x = x0; x <= x1; ++x)
         {
-            curPixel = diff;
-            pTempData = pData;
-            pixels = *pTempData;
-            for (x = x0; x <= x1; ++x)
+            shift = (1 - curPixel) << 2;
+            index = (pixels & (0xF0 >> (4 - shift))) >> shift;
+            if (index)
             {
-                shift = (1 - curPixel) << 2;
-                index = (pixels & (0xF0 >> (4 - shift))) >> shift;
-                if (index)
-                    _SetPixelIndex(pDevice, x, y, pTrans[index]);
-                if (++curPixel == 2)
+                if (xSpan < 0)
                 {
-                    curPixel = 0;
-                    pixels = *(++pTempData);
+                    xSpan = x;
+                    pSpanData = pTempData;
+                    spanPixel = curPixel;
                 }
             }
-            pData += stride;
-        }
-    }
-    else
-    {
-        for (y = y0; y <= y1; ++y)
-        {
-            curPixel = diff;
-            pTempData = pData;
-            pixels = *pTempData;
-            for (x = x0; x <= x1; ++x)
+            else if (xSpan >= 0)
             {
-                shift = (1 - curPixel) << 2;
-                index = (pixels & (0xF0 >> (4 - shift))) >> shift;
-                if (index)
-                    _SetPixelIndex(pDevice, x, y, index);
-                if (++curPixel == 2)
-               {
-                   curPixel = 0;
-                   pixels = *(++pTempData);
-               }
+                _DrawIndexedSpan(pDevice, xSpan, y, x - 1, pSpanData, spanPixel, 4, pTrans);
+                xSpan = -1;
+            }
+            if (++curPixel == 2)
+            {
+                curPixel = 0;
+                pixels = *(++pTempData);
             }
-            pData += stride;
         }
+        if (xSpan >= 0)
+            _DrawIndexedSpan(pDevice, xSpan, y, x1, pSpanData, spanPixel, 4, pTrans);
+        pData += stride;
     }
 }
 
@@ -1187,43 +1403,32 @@ static inline void _DrawBitmap8BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
     DRIVER_CONTEXT *pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     int x1 = x0 + width - 1;
     int y1 = y0 + height - 1;
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
     U16 x0phys, x1phys, y0phys, y1phys;
     x0phys = LOG2PHYS_X(x0, y0);
     x1phys = LOG2PHYS_X(x1, y1);
     y0phys = LOG2PHYS_Y(x0, y0);
     y1phys = LOG2PHYS_Y(x1, y1);
-#else
-    //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-    #define x0phys ((U16)x0)
-    #define x1phys ((U16)x1)
-    #define y0phys ((U16)y0)
-    #define y1phys ((U16)y1)
-    //! @endcond
-#endif
-    // Set column start
-    pContext->pfWriteReg(0x0002);
-    pContext->pfWriteData(HIBYTE(x0phys));
-    pContext->pfWriteReg(0x0003);
-    pContext->pfWriteData(LOBYTE(x0phys));
-    // Set column end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(x1phys));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(x1phys));
-    // Set row start
-    pContext->pfWriteReg(0x0006);
-    pContext->pfWriteData(HIBYTE(y0phys));
-    pContext->pfWriteReg(0x0007);
-    pContext->pfWriteData(LOBYTE(y0phys));
-    // Set row end
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(y1phys));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(y1phys));
+    // Set window
+    _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
     // Write data
     pContext->pfWriteReg(0x0022);
-    if (pTrans)
+    if (pTrans && pContext->pfWriteMultipleDataLUT)
+    {
+        if (stride == width)
+        {
+            // Lines are contiguous, write the whole bitmap at once
+            pContext->pfWriteMultipleDataLUT(pData, pTrans, width * height);
+        }
+        else
+        {
+            for (y0 = 0; y0 < height; ++y0)
+            {
+                pContext->pfWriteMultipleDataLUT(pData, pTrans, width);
+                pData += stride;
+            }
+        }
+    }
+    else if (pTrans)
     {
         for (y0 = 0; y0 < height; ++y0) // reuse x0, y0 here
         {
@@ -1247,21 +1452,6 @@ static inline void _DrawBitmap8BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
             pData += stride;
         }
     }
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-    #undef x0phys
-    #undef x1phys
-    #undef y0phys
-    #undef y1phys
-#endif
-    // Restore column/row end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
 }
 
 
@@ -1278,36 +1468,34 @@ static inline void _DrawBitmap8BPPOpaque(GUI_DEVICE *pDevice, int x0, int y0, in
  */
 static inline void _DrawBitmap8BPPTransparent(GUI_DEVICE *pDevice, int x0, int y0, int width, int height, int stride, U8 const GUI_UNI_PTR *pData, const LCD_PIXELINDEX * pTrans)
 {
-    LCD_PIXELINDEX pixel;
     int x1 = x0 + width - 1;
     int y1 = y0 + height - 1;
     int x, y, i;
+    int xSpan, iSpan;
 
-    if (pTrans)
+    iSpan = 0;
+    for (y = y0; y <= y1; ++y)
     {
-        for (y = y0; y <= y1; ++y)
+        xSpan = -1; // No opaque span yet
+        for (x = x0, i = 0; x <= x1; ++x, ++i)
         {
-            for (x = x0, i = 0; x <= x1; ++x, ++i)
+            if (pData[i])
             {
-                pixel = pData[i];
-                if (pixel)
-                    _SetPixelIndex(pDevice, x, y, pTrans[pixel]);
+                if (xSpan < 0)
+                {
+                    xSpan = x;
+                    iSpan = i;
+                }
             }
-            pData += stride;
-        }
-    }
-    else
-    {
-        for (y = y0; y <= y1; ++y)
-        {
-            for (x = x0, i = 0; x <= x1; ++x, ++i)
+            else if (xSpan >= 0)
             {
-                pixel = pData[i];
-                if (pixel)
-                    _SetPixelIndex(pDevice, x, y, pixel);
+                _DrawIndexedSpan(pDevice, xSpan, y, x - 1, pData + iSpan, 0, 8, pTrans);
+                xSpan = -1;
             }
-            pData += stride;
         }
+        if (xSpan >= 0)
+            _DrawIndexedSpan(pDevice, xSpan, y, x1, pData + iSpan, 0, 8, pTrans);
+        pData += stride;
     }
 }
 
@@ -1352,62 +1540,224 @@ static inline void _DrawBitmap16BPP(GUI_DEVICE *pDevice, int x0, int y0, int wid
     DRIVER_CONTEXT *pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     int x1 = x0 + width - 1;
     int y1 = y0 + height - 1;
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
     U16 x0phys, x1phys, y0phys, y1phys;
     x0phys = LOG2PHYS_X(x0, y0);
     x1phys = LOG2PHYS_X(x1, y1);
     y0phys = LOG2PHYS_Y(x0, y0);
     y1phys = LOG2PHYS_Y(x1, y1);
-#else
-    //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-    #define x0phys ((U16)x0)
-    #define x1phys ((U16)x1)
-    #define y0phys ((U16)y0)
-    #define y1phys ((U16)y1)
-    //! @endcond
-#endif
-    // Set column start
-    pContext->pfWriteReg(0x0002);
-    pContext->pfWriteData(HIBYTE(x0phys));
-    pContext->pfWriteReg(0x0003);
-    pContext->pfWriteData(LOBYTE(x0phys));
-    // Set column end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(x1phys));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(x1phys));
-    // Set row start
-    pContext->pfWriteReg(0x0006);
-    pContext->pfWriteData(HIBYTE(y0phys));
-    pContext->pfWriteReg(0x0007);
-    pContext->pfWriteData(LOBYTE(y0phys));
-    // Set row end
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(y1phys));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(y1phys));
+    if (pContext->asyncFlush)
+    {
+        // Previous band may still be streaming
+        pContext->pfWaitIdle();
+        if (stride == width * 2)
+        {
+            _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
+            pContext->pfWriteReg(0x0022);
+            ++pContext->asyncSeq;
+            pContext->pfWriteMultipleDataAsync((U16 *)pData, width * height, _AsyncDone);
+            return;
+        }
+    }
+    // Set window
+    _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
     // Write data
     pContext->pfWriteReg(0x0022);
+    if ((stride == width * 2) || (height == 1))
+    {
+        // Contiguous lines go in one burst
+        pContext->pfWriteMultipleData((U16 *)pData, width * height);
+        return;
+    }
     for (y0 = 0; y0 < height; ++y0) // reuse x0, y0 here
     {
         pContext->pfWriteMultipleData((U16 *)pData, width);
         pData = (U16 const GUI_UNI_PTR*)((U8 *)pData + stride);
      }
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-     #undef x0phys
-     #undef x1phys
-     #undef y0phys
-     #undef y1phys
-#endif
-    // Restore column/row end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
+}
+
+
+/**
+ * @brief   Draw 24BPP bitmap
+ * @note    Pixels are 3 bytes R, G, B. They are converted in chunks of
+ *          CONV_BUFFER_SIZE into a stack buffer which is burst into one
+ *          window covering the whole bitmap. The conversion is inlined for
+ *          GUICC_565, other color conversions go through pfColor2Index.
+ * @param   pDevice Device context
+ * @param   x0      Starting X coordinate
+ * @param   y0      Starting Y coordinate
+ * @param   width   Bitmap width
+ * @param   height  Bitmap height
+ * @param   stride  Bytes per scan line, can be 0 if (height == 1)
+ * @param   pData   Bitmap data
+ */
+static inline void _DrawBitmap24BPP(GUI_DEVICE *pDevice, int x0, int y0, int width, int height, int stride, U8 const GUI_UNI_PTR *pData)
+{
+    DRIVER_CONTEXT *pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    const LCD_API_COLOR_CONV *pColorConv = pDevice->pColorConvAPI;
+    U16 buffer[CONV_BUFFER_SIZE];
+    const U8 GUI_UNI_PTR *p;
+    int x, y, i, count;
+    int x1 = x0 + width - 1;
+    int y1 = y0 + height - 1;
+    U16 x0phys, x1phys, y0phys, y1phys;
+    x0phys = LOG2PHYS_X(x0, y0);
+    x1phys = LOG2PHYS_X(x1, y1);
+    y0phys = LOG2PHYS_Y(x0, y0);
+    y1phys = LOG2PHYS_Y(x1, y1);
+    // Set window
+    _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
+    // Write data
+    pContext->pfWriteReg(0x0022);
+    for (y = 0; y < height; ++y)
+    {
+        p = pData;
+        for (x = 0; x < width; x += count)
+        {
+            count = width - x;
+            if (count > CONV_BUFFER_SIZE)
+                count = CONV_BUFFER_SIZE;
+            if (pColorConv == GUICC_565)
+            {
+                for (i = 0; i < count; ++i, p += 3)
+                    buffer[i] = (U16)((p[0] >> 3) | ((p[1] & 0xFC) << 3) | ((p[2] & 0xF8) << 8));
+            }
+            else
+            {
+                for (i = 0; i < count; ++i, p += 3)
+                    buffer[i] = (U16)pColorConv->pfColor2Index(p[0] | ((U32)p[1] << 8) | ((U32)p[2] << 16));
+            }
+            pContext->pfWriteMultipleData(buffer, count);
+        }
+        pData += stride;
+    }
+}
+
+
+/**
+ * @brief   Blend a color over a background color
+ * @param   color   Foreground color
+ * @param   bkColor Background color
+ * @param   alpha   Alpha of foreground, 0x00 opaque, 0xFF transparent
+ * @return  Blended color
+ */
+static inline U32 _MixColors(U32 color, U32 bkColor, U32 alpha)
+{
+    U32 rb, g;
+    alpha += alpha >> 7;    // 0..256
+    rb = ((color & 0xFF00FF) * (256 - alpha) + (bkColor & 0xFF00FF) * alpha) >> 8;
+    g = ((color & 0x00FF00) * (256 - alpha) + (bkColor & 0x00FF00) * alpha) >> 8;
+    return (rb & 0xFF00FF) | (g & 0x00FF00);
+}
+
+
+/**
+ * @brief   Convert a GUICC_565 index to a color, as its pfIndex2Color does
+ * @param   index   RGB565 index, red in the low bits
+ * @return  Color with the MSBs of each component replicated into its LSBs
+ */
+static inline U32 _Index2Color565(U32 index)
+{
+    return ((index & 0x001F) << 3) | ((index & 0x001C) >> 2) |
+           ((index & 0x07E0) << 5) | ((index & 0x0600) >> 1) |
+           ((index & 0xF800) << 8) | ((index & 0xE000) << 3);
+}
+
+
+/**
+ * @brief   Draw 32BPP bitmap with alpha channel
+ * @note    Pixels are emWin colors with alpha in the top byte, 0x00 opaque,
+ *          0xFF transparent. Each line is split into spans of non transparent
+ *          pixels of up to ALPHA_BUFFER_SIZE. A span with semi-transparent
+ *          pixels is read back in one burst, blended in RAM and written back
+ *          to the same window, an opaque span is only written. In XOR mode
+ *          the spans invert the screen instead. If pTrans is not NULL, pixels
+ *          are palette indices as with the indexed formats, without alpha.
+ *          The conversion is inlined for GUICC_565, other color conversions
+ *          go through pfIndex2Color and pfColor2Index.
+ * @param   pDevice Device context
+ * @param   x0      Starting X coordinate
+ * @param   y0      Starting Y coordinate
+ * @param   width   Bitmap width
+ * @param   height  Bitmap height
+ * @param   stride  Bytes per scan line, can be 0 if (height == 1)
+ * @param   pData   Bitmap data
+ * @param   pTrans  Palette, NULL for colors with alpha
+ */
+static inline void _DrawBitmap32BPP(GUI_DEVICE *pDevice, int x0, int y0, int width, int height, int stride, U32 const GUI_UNI_PTR *pData, const LCD_PIXELINDEX *pTrans)
+{
+    DRIVER_CONTEXT *pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    const LCD_API_COLOR_CONV *pColorConv = pDevice->pColorConvAPI;
+    U16 buffer[ALPHA_BUFFER_SIZE];
+    U32 color, alpha;
+    int x, y, i, count, blend, xor;
+
+    xor = (GUI_pContext->DrawMode & LCD_DRAWMODE_XOR) != 0;
+    for (y = y0; y < y0 + height; ++y)
+    {
+        x = 0;
+        while (x < width)
+        {
+            // Skip transparent pixels
+            if ((pTrans == NULL) && ((pData[x] >> 24) == 0xFF))
+            {
+                ++x;
+                continue;
+            }
+            // Collect span of visible pixels
+            blend = 0;
+            for (count = 0; (count < ALPHA_BUFFER_SIZE) && (x + count < width); ++count)
+            {
+                alpha = pTrans ? 0 : (pData[x + count] >> 24);
+                if (alpha == 0xFF)
+                    break;
+                if (alpha)
+                    blend = 1;
+            }
+            if (xor)
+            {
+                _XorRect(pDevice, x0 + x, y, x0 + x + count - 1, y);
+                x += count;
+                continue;
+            }
+            _OpenSpan(pContext, x0 + x, y, x0 + x + count - 1);
+            if (blend)
+            {
+                // Writing R22h again restarts from window start
+                _ReadPixels565(pContext, buffer, count);
+                pContext->pfWriteReg(0x0022);
+            }
+            if (pTrans)
+            {
+                for (i = 0; i < count; ++i)
+                    buffer[i] = (U16)pTrans[pData[x + i]];
+            }
+            else if (pColorConv == GUICC_565)
+            {
+                for (i = 0; i < count; ++i)
+                {
+                    color = pData[x + i];
+                    alpha = color >> 24;
+                    if (alpha)
+                        color = _MixColors(color, _Index2Color565(buffer[i]), alpha);
+                    buffer[i] = (U16)(((color & 0xF8) >> 3) | ((color & 0xFC00) >> 5) | ((color & 0xF80000) >> 8));
+                }
+            }
+            else
+            {
+                for (i = 0; i < count; ++i)
+                {
+                    color = pData[x + i];
+                    alpha = color >> 24;
+                    if (alpha)
+                        color = _MixColors(color, pColorConv->pfIndex2Color(buffer[i]), alpha);
+                    buffer[i] = (U16)pColorConv->pfColor2Index(color & 0xFFFFFF);
+                }
+            }
+            pContext->pfWriteMultipleData(buffer, count);
+            x += count;
+        }
+        pData = (U32 const GUI_UNI_PTR *)((const U8 *)pData + stride);
+    }
 }
 
 
@@ -1443,6 +1793,51 @@ static void _DrawBitmap(GUI_DEVICE *pDevice, int x0, int y0, int width, int heig
     case 16:
         _DrawBitmap16BPP(pDevice, x0, y0, width, height, stride, (const U16 *)pData);
         break;
+    case 24:
+        _DrawBitmap24BPP(pDevice, x0, y0, width, height, stride, (const U8 *)pData);
+        break;
+    case 32:
+        _DrawBitmap32BPP(pDevice, x0, y0, width, height, stride, (const U32 *)pData, pTrans);
+        break;
+    }
+}
+
+
+/**
+ * @brief   Compute screen size, coordinate offsets and hardware clip
+ * @note    The scroll axis (Y, or X if swapped) always has YSIZE_PHYS visible
+ *          lines out of VSIZE_PHYS. Without virtual screen, a mirrored
+ *          scroll axis shows the last GRAM lines. With virtual screen,
+ *          logical lines map 1:1 to GRAM lines and scrolling does the offset.
+ * @param   pContext    Driver context
+ */
+static void _SetGeometry(DRIVER_CONTEXT *pContext)
+{
+    if ((pContext->vSize == YSIZE_PHYS) && (pContext->orientation & HX8352C_MIRROR_Y))
+        pContext->scrollBase = VSIZE_PHYS - YSIZE_PHYS;
+    else
+        pContext->scrollBase = 0;
+    if (pContext->orientation & HX8352C_SWAP_XY)
+    {
+        pContext->xSize = YSIZE_PHYS;
+        pContext->ySize = XSIZE_PHYS;
+        pContext->xOff = pContext->scrollBase;
+        pContext->yOff = 0;
+        pContext->hwClip.x0 = pContext->scrollBase;
+        pContext->hwClip.x1 = pContext->scrollBase + pContext->vSize - 1;
+        pContext->hwClip.y0 = 0;
+        pContext->hwClip.y1 = XSIZE_PHYS - 1;
+    }
+    else
+    {
+        pContext->xSize = XSIZE_PHYS;
+        pContext->ySize = YSIZE_PHYS;
+        pContext->xOff = 0;
+        pContext->yOff = pContext->scrollBase;
+        pContext->hwClip.x0 = 0;
+        pContext->hwClip.x1 = XSIZE_PHYS - 1;
+        pContext->hwClip.y0 = pContext->scrollBase;
+        pContext->hwClip.y1 = pContext->scrollBase + pContext->vSize - 1;
     }
 }
 
@@ -1461,53 +1856,39 @@ static int _InitOnce(GUI_DEVICE *pDevice)
     {
         pDevice->u.pContext = GUI_ALLOC_GetFixedBlock(sizeof(DRIVER_CONTEXT));
         pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
-        // Clipping is dependent on rotation
-#if (!LCD_MIRROR_X && !LCD_MIRROR_Y && !LCD_SWAP_XY)
-        pContext->hwClip.x0 = 0;
-        pContext->hwClip.x1 = LCD_XSIZE - 1;
-        pContext->hwClip.y0 = 0;
-        pContext->hwClip.y1 = LCD_YSIZE - 1;
-#elif (!LCD_MIRROR_X && !LCD_MIRROR_Y && LCD_SWAP_XY)
-        pContext->hwClip.x0 = 0;
-        pContext->hwClip.x1 = LCD_XSIZE - 1;
-        pContext->hwClip.y0 = 0;
-        pContext->hwClip.y1 = LCD_YSIZE - 1;
-#elif (!LCD_MIRROR_X && LCD_MIRROR_Y && !LCD_SWAP_XY)
-        pContext->hwClip.x0 = 0;
-        pContext->hwClip.x1 = LCD_XSIZE - 1;
-        pContext->hwClip.y0 = 432 - LCD_YSIZE;
-        pContext->hwClip.y1 = 431;
-#elif (!LCD_MIRROR_X && LCD_MIRROR_Y && LCD_SWAP_XY)
-        pContext->hwClip.x0 = 432 - LCD_XSIZE;
-        pContext->hwClip.x1 = 431;
-        pContext->hwClip.y0 = 0;
-        pContext->hwClip.y1 = LCD_YSIZE - 1;
-#elif (LCD_MIRROR_X && !LCD_MIRROR_Y && !LCD_SWAP_XY)
-        pContext->hwClip.x0 = 0;
-        pContext->hwClip.x1 = LCD_XSIZE - 1;
-        pContext->hwClip.y0 = 0;
-        pContext->hwClip.y1 = LCD_YSIZE - 1;
-#elif (LCD_MIRROR_X && !LCD_MIRROR_Y && LCD_SWAP_XY)
-        pContext->hwClip.x0 = 0;
-        pContext->hwClip.x1 = LCD_XSIZE - 1;
-        pContext->hwClip.y0 = 0;
-        pContext->hwClip.y1 = LCD_YSIZE - 1;
-#elif (LCD_MIRROR_X && LCD_MIRROR_Y && !LCD_SWAP_XY)
-        pContext->hwClip.x0 = 0;
-        pContext->hwClip.x1 = LCD_XSIZE - 1;
-        pContext->hwClip.y0 = 432 - LCD_YSIZE;
-        pContext->hwClip.y1 = 431;
-#elif (LCD_MIRROR_X &&  LCD_MIRROR_Y &&  LCD_SWAP_XY)
-        pContext->hwClip.x0 = 432 - LCD_XSIZE;
-        pContext->hwClip.x1 = 431;
-        pContext->hwClip.y0 = 0;
-        pContext->hwClip.y1 = LCD_YSIZE - 1;
+        // Start-up orientation from LCDConf.h
+        pContext->orientation = 0;
+#if LCD_SWAP_XY
+        pContext->orientation |= HX8352C_SWAP_XY;
+#endif
+#if LCD_MIRROR_X
+        pContext->orientation |= HX8352C_MIRROR_X;
 #endif
+#if LCD_MIRROR_Y
+        pContext->orientation |= HX8352C_MIRROR_Y;
+#endif
+        pContext->vSize = YSIZE_PHYS;
+        pContext->scrollOrg = 0;
+        pContext->scrollOn = 0;
+        pContext->initDone = 0;
+        _SetGeometry(pContext);
+        _InvalidateWindow(pContext);
         pContext->pfWriteReg = 0;
         pContext->pfWriteData = 0;
+        pContext->pfWriteRegSequence = 0;
         pContext->pfWriteMultipleData = 0;
+        pContext->pfWriteRepeatingData = 0;
+        pContext->pfWriteMultipleDataLUT = 0;
+        pContext->pfWriteMultipleData2BPP = 0;
+        pContext->pfWriteMultipleData4BPP = 0;
+        pContext->pfReadReg = 0;
         pContext->pfReadData = 0;
         pContext->pfReadMultipleData = 0;
+        pContext->pfReadPixels565 = 0;
+        pContext->pfWriteMultipleDataAsync = 0;
+        pContext->pfWaitIdle = 0;
+        pContext->asyncFlush = 0;
+        pContext->asyncSeq = _asyncDone;
     }
     return pDevice->u.pContext ? 0 : 1;
 }
@@ -1522,16 +1903,21 @@ static int _InitOnce(GUI_DEVICE *pDevice)
  */
 static I32 _GetDevProp(GUI_DEVICE *pDevice, int index)
 {
+    DRIVER_CONTEXT *pContext;
+    // emWin may query properties before LCD_X_Config() set the hooks
+    if (_InitOnce(pDevice))
+        return -1;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     switch (index)
     {
     case LCD_DEVCAP_XSIZE:
-        return LCD_XSIZE;
+        return pContext->xSize;
     case LCD_DEVCAP_YSIZE:
-        return LCD_YSIZE;
+        return pContext->ySize;
     case LCD_DEVCAP_VXSIZE:
-        return LCD_XSIZE;
+        return (pContext->orientation & HX8352C_SWAP_XY) ? pContext->vSize : pContext->xSize;
     case LCD_DEVCAP_VYSIZE:
-        return LCD_YSIZE;
+        return (pContext->orientation & HX8352C_SWAP_XY) ? pContext->ySize : pContext->vSize;
     case LCD_DEVCAP_BITSPERPIXEL:
         return LCD__GetBPP(pDevice->pColorConvAPI->pfGetIndexMask());
     case LCD_DEVCAP_NUMCOLORS:
@@ -1582,11 +1968,113 @@ static void * _GetDevData(GUI_DEVICE *pDevice, int index)
  */
 static void _GetRect(GUI_DEVICE *pDevice, LCD_RECT *pRect)
 {
-    GUI_USE_PARA(pDevice);
+    DRIVER_CONTEXT *pContext;
     pRect->x0 = 0;
     pRect->y0 = 0;
-    pRect->x1 = LCD_XSIZE - 1;
-    pRect->y1 = LCD_YSIZE - 1;
+    if (_InitOnce(pDevice))
+    {
+        pRect->x1 = -1;
+        pRect->y1 = -1;
+        return;
+    }
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    pRect->x1 = pContext->xSize - 1;
+    pRect->y1 = pContext->ySize - 1;
+}
+
+
+/**
+ * @brief   Write vertical scroll start (R14h-R15h) for an origin
+ * @note    With virtual screen, logical line N lives at GRAM line N. The panel
+ *          scans GRAM lines from the scroll start pointer, in reversed order
+ *          if the scroll axis is mirrored.
+ * @param   pContext    Driver context
+ * @param   org         Origin along the scroll axis
+ */
+static void _SetScrollStart(DRIVER_CONTEXT *pContext, int org)
+{
+    U16 pairs[4];
+    U16 vsp;
+    if (pContext->orientation & HX8352C_MIRROR_Y)
+        vsp = (U16)((2 * VSIZE_PHYS - YSIZE_PHYS - org) % VSIZE_PHYS);
+    else
+        vsp = (U16)org;
+    pairs[0] = 0x0014;
+    pairs[1] = HIBYTE(vsp);
+    pairs[2] = 0x0015;
+    pairs[3] = LOBYTE(vsp);
+    _WriteRegSequence(pContext, pairs, 2);
+}
+
+
+/**
+ * @brief   Program the scroll area (R0Eh-R15h) for the virtual screen size
+ * @note    Scrolling is on while the scroll axis is larger than the screen.
+ *          Otherwise the scroll start goes back to 0, which shows GRAM lines
+ *          0 to 399 as without scrolling. The scroll mode bit in R01h is set
+ *          by the controller initialization sequence.
+ * @param   pContext    Driver context
+ */
+static void _SetScrollArea(DRIVER_CONTEXT *pContext)
+{
+    static const U16 scrollArea[] =
+    {
+        0x000E, 0x0000,                 // TFA = 0
+        0x000F, 0x0000,
+        0x0010, VSIZE_PHYS >> 8,        // VSA = 432, all lines scroll
+        0x0011, VSIZE_PHYS & 0xFF,
+        0x0012, 0x0000,                 // BFA = 0
+        0x0013, 0x0000
+    };
+    static const U16 scrollOff[] =
+    {
+        0x0014, 0x0000,                 // VSP = 0
+        0x0015, 0x0000
+    };
+    _WriteRegSequence(pContext, scrollArea, GUI_COUNTOF(scrollArea) / 2);
+    if (pContext->vSize > YSIZE_PHYS)
+    {
+        _SetScrollStart(pContext, pContext->scrollOrg);
+        pContext->scrollOn = 1;
+    }
+    else
+    {
+        _WriteRegSequence(pContext, scrollOff, GUI_COUNTOF(scrollOff) / 2);
+        pContext->scrollOn = 0;
+    }
+}
+
+
+/**
+ * @brief   Set virtual screen size, LCD_DEVFUNC_SET_VSIZE
+ * @note    Only the scroll axis (Y, or X if swapped) can be larger than
+ *          the screen, up to the 432 GRAM lines. Other sizes are clamped.
+ *          After GUI_Init() scrolling is switched on or off at once, redraw
+ *          the screen as a mirrored scroll axis moves the content in GRAM.
+ * @param   pDevice Device context
+ * @param   xSize   Virtual X size
+ * @param   ySize   Virtual Y size
+ */
+static void _SetVSize(GUI_DEVICE *pDevice, int xSize, int ySize)
+{
+    DRIVER_CONTEXT *pContext;
+    int vSize;
+    _InitOnce(pDevice);
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    vSize = (pContext->orientation & HX8352C_SWAP_XY) ? xSize : ySize;
+    if (vSize < YSIZE_PHYS)
+        vSize = YSIZE_PHYS;
+    if (vSize > VSIZE_PHYS)
+        vSize = VSIZE_PHYS;
+    pContext->vSize = vSize;
+    if (pContext->scrollOrg > vSize - YSIZE_PHYS)
+        pContext->scrollOrg = vSize - YSIZE_PHYS;
+    _SetGeometry(pContext);
+    if (pContext->initDone)
+    {
+        _SetWindow(pContext, pContext->hwClip.x0, pContext->hwClip.y0, pContext->hwClip.x1, pContext->hwClip.y1);
+        _SetScrollArea(pContext);
+    }
 }
 
 
@@ -1596,16 +2084,26 @@ static void _GetRect(GUI_DEVICE *pDevice, LCD_RECT *pRect)
 */
 /**
  * @brief   Set origin, only used with Virtual Screen
+ * @note    Origin moves along the scroll axis only, by rewriting the vertical
+ *          scroll start pointer.
  * @param   pDevice Device context
  * @param   x   X coordinate
  * @param   y   Y Coordinate
  */
 static void _SetOrg(GUI_DEVICE *pDevice, int x, int y)
 {
-    // Virtual screen not supported on this controller
-    GUI_USE_PARA(pDevice);
-    GUI_USE_PARA(x);
-    GUI_USE_PARA(y);
+    DRIVER_CONTEXT *pContext;
+    int org;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    org = (pContext->orientation & HX8352C_SWAP_XY) ? x : y;
+    if (org < 0)
+        org = 0;
+    if (org > pContext->vSize - YSIZE_PHYS)
+        org = pContext->vSize - YSIZE_PHYS;
+    pContext->scrollOrg = org;
+    // Before _Init() the origin is only remembered
+    if (pContext->scrollOn)
+        _SetScrollStart(pContext, org);
 }
 
 
@@ -1620,7 +2118,6 @@ static int _Init(GUI_DEVICE *pDevice)
 {
     int r;
     DRIVER_CONTEXT *pContext;
-    U16 r16h;   // HX8352 R16h register value
 
     // Call user command handler
     r = LCD_X_DisplayDriver(pDevice->LayerIndex, LCD_X_INITCONTROLLER, NULL);
@@ -1628,35 +2125,14 @@ static int _Init(GUI_DEVICE *pDevice)
     {
         pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
         // Set screen rotation
-        r16h = 0;
-#if LCD_SWAP_XY
-        r16h |= 0x0020;
-#endif
-#if LCD_MIRROR_X
-        r16h |= 0x0040;
-#endif
-#if LCD_MIRROR_Y
-        r16h |= 0x0080;
-#endif
         pContext->pfWriteReg(0x0016);
-        pContext->pfWriteData(r16h);
+        pContext->pfWriteData(pContext->orientation);
         // Set hardware clip
-        pContext->pfWriteReg(0x0002);
-        pContext->pfWriteData(HIBYTE(pContext->hwClip.x0));
-        pContext->pfWriteReg(0x0003);
-        pContext->pfWriteData(LOBYTE(pContext->hwClip.x0));
-        pContext->pfWriteReg(0x0004);
-        pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-        pContext->pfWriteReg(0x0005);
-        pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-        pContext->pfWriteReg(0x0006);
-        pContext->pfWriteData(HIBYTE(pContext->hwClip.y0));
-        pContext->pfWriteReg(0x0007);
-        pContext->pfWriteData(LOBYTE(pContext->hwClip.y0));
-        pContext->pfWriteReg(0x0008);
-        pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-        pContext->pfWriteReg(0x0009);
-        pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
+        _InvalidateWindow(pContext);   // Controller has just been reset
+        _SetWindow(pContext, pContext->hwClip.x0, pContext->hwClip.y0, pContext->hwClip.x1, pContext->hwClip.y1);
+        // Scroll area for virtual screen
+        _SetScrollArea(pContext);
+        pContext->initDone = 1;
     }
     return r;
 }
@@ -1697,77 +2173,59 @@ static void _ReadRect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1, LCD_P
 {
     DRIVER_CONTEXT *pContext;
     I32 total;
-    U16 read[3];
     U16 *pBuf;
     total = (x1 - x0 + 1) * (y1 - y0 + 1);
     pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     pBuf = (U16*)pBuffer;
-#if (LCD_MIRROR_X == 1) || (LCD_MIRROR_Y == 1) || (LCD_SWAP_XY == 1)
     U16 x0phys, x1phys, y0phys, y1phys;
     x0phys = LOG2PHYS_X(x0, y0);
     x1phys = LOG2PHYS_X(x1, y1);
     y0phys = LOG2PHYS_Y(x0, y0);
     y1phys = LOG2PHYS_Y(x1, y1);
-#else
-    //! @cond DOXYGEN_SHOW_UNDOC_MACRO
-    #define x0phys ((U16)x0)
-    #define x1phys ((U16)x1)
-    #define y0phys ((U16)y0)
-    #define y1phys ((U16)y1)
-    //! @endcond
-#endif
-    // Set column start
-    pContext->pfWriteReg(0x0002);
-    pContext->pfWriteData(HIBYTE(x0phys));
-    pContext->pfWriteReg(0x0003);
-    pContext->pfWriteData(LOBYTE(x0phys));
-    // Set column end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(x1phys));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(x1phys));
-    // Set row start
-    pContext->pfWriteReg(0x0006);
-    pContext->pfWriteData(HIBYTE(y0phys));
-    pContext->pfWriteReg(0x0007);
-    pContext->pfWriteData(LOBYTE(y0phys));
-    // Set row end
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(y1phys));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(y1phys));
+    // Set window
+    _SetWindow(pContext, x0phys, y0phys, x1phys, y1phys);
     // Read data
     pContext->pfWriteReg(0x0022);
-    pContext->pfReadData();    // Dummy read
-    while (total > 1)
-    {
-        pContext->pfReadMultipleData(read, 3);
-        *pBuf = ((read[0] & 0xF800) | ((read[0] & 0x00FC) << 3) | (read[1] >> 11));
-        ++pBuf;
-        *pBuf = (((read[1] & 0x00F8) << 8) | ((read[2] & 0xFC00) >> 5) | ((read[2] & 0x00F8) >> 3));
-        ++pBuf;
-        total -= 2;
-    }
-    if (total > 0)  // total == 1
-    {
-        pContext->pfReadMultipleData(read, 2);
-        *pBuf = ((read[0] & 0xF800) | ((read[0] & 0x00FC) << 3) | (read[1] >> 11));
-    }
-#if (LCD_MIRROR_X == 0) && (LCD_MIRROR_Y == 0) && (LCD_SWAP_XY == 0)
-    #undef x0phys
-    #undef x1phys
-    #undef y0phys
-    #undef y1phys
-#endif
-    // Restore column/row end
-    pContext->pfWriteReg(0x0004);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0005);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.x1));
-    pContext->pfWriteReg(0x0008);
-    pContext->pfWriteData(HIBYTE(pContext->hwClip.y1));
-    pContext->pfWriteReg(0x0009);
-    pContext->pfWriteData(LOBYTE(pContext->hwClip.y1));
+    _ReadPixels565(pContext, pBuf, total);
+}
+
+
+/**
+ * @brief   Copy a block of display memory, LCD_DEVFUNC_COPYRECT
+ * @note    Caller ensures both rectangles are on the screen, they may overlap.
+ * @param   pDevice Device context
+ * @param   x0      Source X coordinate
+ * @param   y0      Source Y coordinate
+ * @param   x1      Destination X coordinate
+ * @param   y1      Destination Y coordinate
+ * @param   xSize   Width of the block
+ * @param   ySize   Height of the block
+ */
+static void _CopyRect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1, int xSize, int ySize)
+{
+    DRIVER_CONTEXT *pContext;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    if ((xSize <= 0) || (ySize <= 0) || ((x0 == x1) && (y0 == y1)))
+        return;
+    _CopyBlock(pContext, x0, y0, x1, y1, xSize, ySize);
+}
+
+
+/**
+ * @brief   Draw a 16bpp bitmap, LCD_DEVFUNC_DRAWBMP_16BPP
+ * @note    The whole bitmap goes through one window and, if its lines are
+ *          contiguous, one pfWriteMultipleData call.
+ * @param   pDevice Device context
+ * @param   x       Starting X coordinate
+ * @param   y       Starting Y coordinate
+ * @param   pData   Pixel data
+ * @param   xSize   Width
+ * @param   ySize   Height
+ * @param   bytesPerLine    Bytes per scan line
+ */
+static void _DrawBmp16BPP(GUI_DEVICE *pDevice, int x, int y, U16 const GUI_UNI_PTR *pData, int xSize, int ySize, int bytesPerLine)
+{
+    _DrawBitmap16BPP(pDevice, x, y, xSize, ySize, bytesPerLine, pData);
 }
 
 
@@ -1791,11 +2249,62 @@ static void (* _GetDevFunc(GUI_DEVICE **ppDevice, int index))(void)
         return (void (*)(void))_Off;
     case LCD_DEVFUNC_READRECT:
         return (void (*)(void))_ReadRect;
+    case LCD_DEVFUNC_COPYRECT:
+        return (void (*)(void))_CopyRect;
+    case LCD_DEVFUNC_DRAWBMP_16BPP:
+        return (void (*)(void))_DrawBmp16BPP;
+    case LCD_DEVFUNC_SET_VSIZE:
+        return (void (*)(void))_SetVSize;
     }
     return NULL;
 }
 
 
+/**
+ * @brief   Get the off-screen GRAM strip used as image cache
+ * @note    GRAM has VSIZE_PHYS lines along the scroll axis, the lines outside
+ *          the (virtual) screen are never shown. They are addressed with
+ *          logical coordinates just before line 0 or just after the last
+ *          line, whichever side the screen leaves free.
+ * @param   pContext    Driver context
+ * @param   pStart      Logical coordinate of the first cache line along the scroll axis
+ * @return  Number of cache lines
+ */
+static int _GetCacheLines(DRIVER_CONTEXT *pContext, int *pStart)
+{
+    *pStart = pContext->scrollBase ? -pContext->scrollBase : pContext->vSize;
+    return VSIZE_PHYS - pContext->vSize;
+}
+
+
+/**
+ * @brief   Convert cache coordinates to logical coordinates
+ * @param   pContext    Driver context
+ * @param   pRect       Rectangle in cache coordinates, converted in place
+ * @return  0 on success, 1 if the rectangle is not inside the cache
+ */
+static int _CacheToLog(DRIVER_CONTEXT *pContext, GUI_RECT *pRect)
+{
+    int start, lines;
+    lines = _GetCacheLines(pContext, &start);
+    if (pContext->orientation & HX8352C_SWAP_XY)
+    {
+        if ((pRect->x0 < 0) || (pRect->x1 >= lines) || (pRect->y0 < 0) || (pRect->y1 >= pContext->ySize) || (pRect->x0 > pRect->x1) || (pRect->y0 > pRect->y1))
+            return 1;
+        pRect->x0 += start;
+        pRect->x1 += start;
+    }
+    else
+    {
+        if ((pRect->x0 < 0) || (pRect->x1 >= pContext->xSize) || (pRect->y0 < 0) || (pRect->y1 >= lines) || (pRect->x0 > pRect->x1) || (pRect->y0 > pRect->y1))
+            return 1;
+        pRect->y0 += start;
+        pRect->y1 += start;
+    }
+    return 0;
+}
+
+
 /*===========================================================================*/
 /* Public Data                                                               */
 /*===========================================================================*/
@@ -1842,11 +2351,301 @@ void GUIDRV_HX8352C_SetFunc(GUI_DEVICE *pDevice, HX8352C_HW_API *pAPI)
     pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
     pContext->pfWriteReg = pAPI->pfWriteReg;
     pContext->pfWriteData = pAPI->pfWriteData;
+    pContext->pfWriteRegSequence = pAPI->pfWriteRegSequence;
     pContext->pfWriteRepeatingData = pAPI->pfWriteRepeatingData;
     pContext->pfWriteMultipleData = pAPI->pfWriteMultipleData;
+    pContext->pfWriteMultipleDataLUT = pAPI->pfWriteMultipleDataLUT;
+    pContext->pfWriteMultipleData2BPP = pAPI->pfWriteMultipleData2BPP;
+    pContext->pfWriteMultipleData4BPP = pAPI->pfWriteMultipleData4BPP;
     pContext->pfReadReg = pAPI->pfReadReg;
     pContext->pfReadData = pAPI->pfReadData;
     pContext->pfReadMultipleData = pAPI->pfReadMultipleData;
+    pContext->pfReadPixels565 = pAPI->pfReadPixels565;
+    pContext->pfWriteMultipleDataAsync = pAPI->pfWriteMultipleDataAsync;
+    pContext->pfWaitIdle = pAPI->pfWaitIdle;
+}
+
+
+/**
+ * @brief   Change display orientation at runtime
+ * @param   orientation Combination of HX8352C_SWAP_XY, HX8352C_MIRROR_X and HX8352C_MIRROR_Y
+ * @return  0 on success, 1 if there is no display driver
+ * @note    The start-up orientation comes from LCDConf.h. Call this after
+ *          GUI_Init(), then redraw the screen: GRAM content and the
+ *          off-screen cache are not converted. Windows already created are
+ *          not resized when X and Y are swapped.
+ */
+int GUIDRV_HX8352C_SetOrientation(int orientation)
+{
+    GUI_DEVICE *pDevice;
+    DRIVER_CONTEXT *pContext;
+
+    pDevice = GUI_DEVICE__GetpDriver(GUI_pContext->SelLayer);
+    if ((pDevice == NULL) || _InitOnce(pDevice))
+        return 1;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    pContext->orientation = (U16)(orientation & (HX8352C_SWAP_XY | HX8352C_MIRROR_X | HX8352C_MIRROR_Y));
+    _SetGeometry(pContext);
+    if (pContext->initDone)
+    {
+        pContext->pfWriteReg(0x0016);
+        pContext->pfWriteData(pContext->orientation);
+        _SetWindow(pContext, pContext->hwClip.x0, pContext->hwClip.y0, pContext->hwClip.x1, pContext->hwClip.y1);
+        // Scroll start of mirrored scroll axis counts from the other end
+        if (pContext->scrollOn)
+            _SetScrollStart(pContext, pContext->scrollOrg);
+    }
+    LCD_SetClipRectMax();
+    return 0;
+}
+
+
+/**
+ * @brief   Draw through two alternating memory device bands
+ * @param   pRect       Area to draw, NULL for the whole screen
+ * @param   pfDraw      Callback drawing the area, called once per band
+ * @param   pData       Parameter passed to pfDraw
+ * @param   numLines    Lines per band, 0 for the whole area
+ * @return  0 on success, 1 if there is no display driver, or if memory
+ *          devices cannot be created and pfDraw was called drawing directly
+ *          to the display
+ * @note    Works like GUI_MEMDEV_Draw(), but a band is streamed to GRAM in
+ *          background (pfWriteMultipleDataAsync) while pfDraw composes the
+ *          next band in the other memory device. pfDraw must only draw into
+ *          the selected memory device.
+ */
+int GUIDRV_HX8352C_MEMDEV_Draw(GUI_RECT *pRect, GUI_CALLBACK_VOID_P *pfDraw, void *pData, int numLines)
+{
+    GUI_DEVICE *pDevice;
+    DRIVER_CONTEXT *pContext;
+    GUI_MEMDEV_Handle ahMem[2], hPrev;
+    void *apLock[2] = { NULL, NULL };
+    U32 aSeq[2];
+    GUI_RECT rect;
+    int width, y, i;
+
+    pDevice = GUI_DEVICE__GetpDriver(GUI_pContext->SelLayer);
+    if ((pDevice == NULL) || _InitOnce(pDevice))
+        return 1;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    if (pRect)
+    {
+        rect = *pRect;
+    }
+    else
+    {
+        rect.x0 = 0;
+        rect.y0 = 0;
+        rect.x1 = pContext->xSize - 1;
+        rect.y1 = pContext->ySize - 1;
+    }
+    width = rect.x1 - rect.x0 + 1;
+    if ((numLines <= 0) || (numLines > rect.y1 - rect.y0 + 1))
+        numLines = rect.y1 - rect.y0 + 1;
+    ahMem[0] = GUI_MEMDEV_CreateFixed(rect.x0, rect.y0, width, numLines, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_16, pDevice->pColorConvAPI);
+    ahMem[1] = GUI_MEMDEV_CreateFixed(rect.x0, rect.y0, width, numLines, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_16, pDevice->pColorConvAPI);
+    if ((ahMem[0] == 0) || (ahMem[1] == 0))
+    {
+        if (ahMem[0])
+            GUI_MEMDEV_Delete(ahMem[0]);
+        if (ahMem[1])
+            GUI_MEMDEV_Delete(ahMem[1]);
+        pfDraw(pData);
+        return 1;
+    }
+    for (y = rect.y0, i = 0; y <= rect.y1; y += numLines, i ^= 1)
+    {
+        // Band i was streamed two bands ago, band (i ^ 1) may not have waited for it
+        if (apLock[i])
+        {
+            _WaitAsync(pContext, aSeq[i]);
+            GUI_ALLOC_UnlockH(&apLock[i]);
+        }
+        GUI_MEMDEV_SetOrg(ahMem[i], rect.x0, y);
+        if (y + numLines > rect.y1 + 1)
+            GUI_MEMDEV_ReduceYSize(ahMem[i], rect.y1 + 1 - y);
+        // Compose
+        hPrev = GUI_MEMDEV_Select(ahMem[i]);
+        pfDraw(pData);
+        GUI_MEMDEV_Select(hPrev);
+        // Flush, memory device must not move while DMA reads it
+        apLock[i] = GUI_ALLOC_LockH(ahMem[i]);
+        pContext->asyncFlush = (pContext->pfWriteMultipleDataAsync != NULL) && (pContext->pfWaitIdle != NULL);
+        GUI_MEMDEV_CopyToLCD(ahMem[i]);
+        pContext->asyncFlush = 0;
+        aSeq[i] = pContext->asyncSeq;
+    }
+    if (pContext->pfWaitIdle)
+        pContext->pfWaitIdle();
+    for (i = 0; i < 2; ++i)
+    {
+        if (apLock[i])
+            GUI_ALLOC_UnlockH(&apLock[i]);
+        GUI_MEMDEV_Delete(ahMem[i]);
+    }
+    return 0;
+}
+
+
+
+/**
+ * @brief   Get size of the off-screen image cache
+ * @param   pxSize  Returns cache width
+ * @param   pySize  Returns cache height
+ * @note    The cache is the strip of GRAM lines outside the (virtual) screen,
+ *          32 lines without virtual screen. Setting a virtual screen size
+ *          shrinks it and invalidates its content.
+ */
+void GUIDRV_HX8352C_CACHE_GetSize(int *pxSize, int *pySize)
+{
+    GUI_DEVICE *pDevice;
+    DRIVER_CONTEXT *pContext;
+    int start, lines;
+
+    *pxSize = 0;
+    *pySize = 0;
+    pDevice = GUI_DEVICE__GetpDriver(GUI_pContext->SelLayer);
+    if ((pDevice == NULL) || _InitOnce(pDevice))
+        return;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    lines = _GetCacheLines(pContext, &start);
+    if (pContext->orientation & HX8352C_SWAP_XY)
+    {
+        *pxSize = lines;
+        *pySize = pContext->ySize;
+    }
+    else
+    {
+        *pxSize = pContext->xSize;
+        *pySize = lines;
+    }
+}
+
+
+/**
+ * @brief   Upload a bitmap into the off-screen image cache
+ * @param   xCache  X position in the cache
+ * @param   yCache  Y position in the cache
+ * @param   pBitmap Bitmap to upload, palette based (1, 2, 4, 8bpp) or GUI_DRAW_BMP565
+ * @return  0 on success, 1 if there is no display driver, the bitmap format
+ *          is not supported or the bitmap does not fit into the cache
+ * @note    The bitmap is drawn opaque, transparent pixels get the color of
+ *          palette entry 0.
+ */
+int GUIDRV_HX8352C_CACHE_Write(int xCache, int yCache, const GUI_BITMAP GUI_UNI_PTR *pBitmap)
+{
+    GUI_DEVICE *pDevice;
+    DRIVER_CONTEXT *pContext;
+    const LCD_PIXELINDEX *pTrans;
+    GUI_RECT rect;
+    LCD_RECT hwClip;
+    LCD_DRAWMODE drawMode;
+
+    pDevice = GUI_DEVICE__GetpDriver(GUI_pContext->SelLayer);
+    if ((pDevice == NULL) || _InitOnce(pDevice))
+        return 1;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    pTrans = NULL;
+    if (pBitmap->pMethods == NULL)
+    {
+        if (pBitmap->BitsPerPixel <= 8)
+        {
+            if (pBitmap->pPal == NULL)
+                return 1;
+            pTrans = LCD_GetpPalConvTable(pBitmap->pPal);
+        }
+    }
+    else if ((pBitmap->pMethods != GUI_DRAW_BMP565) || (pBitmap->BitsPerPixel != 16))
+    {
+        return 1;
+    }
+    rect.x0 = xCache;
+    rect.y0 = yCache;
+    rect.x1 = xCache + pBitmap->XSize - 1;
+    rect.y1 = yCache + pBitmap->YSize - 1;
+    if (_CacheToLog(pContext, &rect))
+        return 1;
+    // Single pixel writes restore the window end to the hardware clip, which must cover the cache
+    hwClip = pContext->hwClip;
+    if (pContext->orientation & HX8352C_SWAP_XY)
+    {
+        pContext->hwClip.x0 = 0;
+        pContext->hwClip.x1 = VSIZE_PHYS - 1;
+    }
+    else
+    {
+        pContext->hwClip.y0 = 0;
+        pContext->hwClip.y1 = VSIZE_PHYS - 1;
+    }
+    drawMode = GUI_pContext->DrawMode;
+    GUI_pContext->DrawMode = LCD_DRAWMODE_NORMAL;
+    _DrawBitmap(pDevice, rect.x0, rect.y0, pBitmap->XSize, pBitmap->YSize, pBitmap->BitsPerPixel, pBitmap->BytesPerLine, pBitmap->pData, 0, pTrans);
+    GUI_pContext->DrawMode = drawMode;
+    pContext->hwClip = hwClip;
+    return 0;
+}
+
+
+/**
+ * @brief   Copy an image from the off-screen cache to the screen
+ * @param   xCache  X position of the image in the cache
+ * @param   yCache  Y position of the image in the cache
+ * @param   xSize   Image width
+ * @param   ySize   Image height
+ * @param   x       X position, relative to the current window
+ * @param   y       Y position, relative to the current window
+ * @return  0 on success, 1 if there is no display driver, the image is not
+ *          inside the cache or a memory device is selected
+ * @note    The image goes from GRAM to GRAM through a small stack buffer,
+ *          neither flash nor the emWin memory pool is read. The destination
+ *          is clipped to the current clip rectangle, window manager
+ *          invalidation is not taken into account. GRAM content cannot be
+ *          drawn into a memory device.
+ */
+int GUIDRV_HX8352C_CACHE_Draw(int xCache, int yCache, int xSize, int ySize, int x, int y)
+{
+    GUI_DEVICE *pDevice;
+    DRIVER_CONTEXT *pContext;
+    GUI_RECT rect;
+    const LCD_RECT *pClip;
+
+#if GUI_SUPPORT_MEMDEV
+    if (GUI_MEMDEV_GetSelMemdev())
+        return 1;
+#endif
+    pDevice = GUI_DEVICE__GetpDriver(GUI_pContext->SelLayer);
+    if ((pDevice == NULL) || _InitOnce(pDevice))
+        return 1;
+    pContext = (DRIVER_CONTEXT *)pDevice->u.pContext;
+    rect.x0 = xCache;
+    rect.y0 = yCache;
+    rect.x1 = xCache + xSize - 1;
+    rect.y1 = yCache + ySize - 1;
+    if (_CacheToLog(pContext, &rect))
+        return 1;
+    // Window to screen coordinates
+    x += GUI_pContext->xOff;
+    y += GUI_pContext->yOff;
+    // Clip destination, moving the source along
+    pClip = &GUI_pContext->ClipRect;
+    if (x < pClip->x0)
+    {
+        rect.x0 += pClip->x0 - x;
+        x = pClip->x0;
+    }
+    if (y < pClip->y0)
+    {
+        rect.y0 += pClip->y0 - y;
+        y = pClip->y0;
+    }
+    if (x + rect.x1 - rect.x0 > pClip->x1)
+        rect.x1 = rect.x0 + pClip->x1 - x;
+    if (y + rect.y1 - rect.y0 > pClip->y1)
+        rect.y1 = rect.y0 + pClip->y1 - y;
+    if ((rect.x0 > rect.x1) || (rect.y0 > rect.y1))
+        return 0;
+    _CopyBlock(pContext, rect.x0, rect.y0, x, y, rect.x1 - rect.x0 + 1, rect.y1 - rect.y0 + 1);
+    return 0;
 }
 
 
@@ -26,6 +26,7 @@
 #include <stddef.h>
 #include <stm32f10x.h>
 #include "HX8352C.h"
+#include "HX8352C_GPIO_Conf.h"
 
 
 /*===========================================================================*/
@@ -33,35 +34,156 @@
 /*===========================================================================*/
 
 
-// LCD 16-bit data bus  GPIOB
-// Reset                GPIOC.4
-// RS                   GPIOC.5
-// WR                   GPIOC.6
-// RD                   GPIOC.7
-// CS                   Wired to GND
+// Board wiring is in HX8352C_GPIO_Conf.h, shared with HX8352C_GPIO_Lowlevel.s
 
-/** \brief GPIOx_BASE of the port connected to LCD data bus. Must be constant for correct timing. */
-const uint32_t LCD_Data_GPIOx_BASE = GPIOB_BASE;
-/** \brief GPIOx_BASE of the port connected to LCD control lines. Must be constant for correct timing. */
-const uint32_t LCD_Ctrl_GPIOx_BASE = GPIOC_BASE;
-/** \brief GPIO_Pin_x of the LCD Reset pin. */
-const uint16_t LCD_RST_Pin         = GPIO_Pin_4;
-/** \brief GPIO_Pin_x of the LCD RS pin. Must be constant for correct timing. */
-const uint16_t LCD_RS_Pin          = GPIO_Pin_5;
-/** \brief GPIO_Pin_x of the LCD Reset pin. Must be constant for correct timing. */
-const uint16_t LCD_WR_Pin          = GPIO_Pin_6;
-/** \brief GPIO_Pin_x of the LCD Reset pin. Must be constant for correct timing. */
-const uint16_t LCD_RD_Pin          = GPIO_Pin_7;
+#if (LCD_WR_PinSource > 7)
+#error "WR pin must be on GPIOx_CRL (pin 0..7)"
+#endif
+
+// The palette kernels in HX8352C_GPIO_Lowlevel.s step through LCD_PIXELINDEX entries 4 bytes at a time
+typedef char _CheckPaletteEntrySize[(sizeof(LCD_PIXELINDEX) == 4) ? 1 : -1];
+
+
+/**
+ * @{
+ * Asynchronous write timing. TIM8 CH1 (PC6) drives WR in PWM mode 1: WR is high
+ * for ASYNC_WR_HIGH_TICKS, falls on CC1 match, which also requests DMA2 Channel 3
+ * to copy next word to data port, and rises (data latched) at counter overflow.
+ * Each DMA transfer must complete within the "L" duration, 10 ticks = 139ns.
+ */
+//! TIM8 ticks (72MHz) of one write cycle, 167ns
+#define ASYNC_CYCLE_TICKS       12
+//! TIM8 ticks WR stays "H" at beginning of write cycle, 28ns
+#define ASYNC_WR_HIGH_TICKS     2
+//! Write cycles per timer run, limited by the 8-bit repetition counter
+#define ASYNC_BURST             256
+//! Words per DMA block, multiple of ASYNC_BURST not exceeding 65535
+#define ASYNC_DMA_BLOCK         (255 * ASYNC_BURST)
+/** @} */
+
+
+/**
+ * @{
+ * Sequence opcodes. A sequence is a list of {register, value} pairs, register
+ * values from SEQ_DELAY up are opcodes. Consecutive register pairs are sent
+ * with one lcdWriteRegSequence() call.
+ */
+//! Wait value ms before next entry
+#define SEQ_DELAY   0xFF00
+//! Drive RESET pin to value (0 or 1)
+#define SEQ_RESET   0xFF01
+//! End of sequence
+#define SEQ_END     0xFFFF
+/** @} */
 
 
 /*===========================================================================*/
-/* Static Functions                                                          */
+/* Static Data                                                               */
 /*===========================================================================*/
 
+//! Next word not yet handed to DMA
+static uint16_t * volatile _asyncData;
+//! Words not yet handed to DMA
+static volatile unsigned int _asyncDmaRemain;
+//! Write cycles not yet started by timer
+static volatile unsigned int _asyncRemain;
+//! Completion callback of current asynchronous write
+static void (* volatile _pfAsyncDone)(void);
+//! Asynchronous write in progress
+static volatile int _asyncBusy;
+
+//! Sequence being run from lcdTick(), NULL when idle
+static const uint16_t * volatile _pSeq;
+//! SysTick periods left before _pSeq continues
+static volatile uint16_t _seqDelay;
+//! lcdInitStart() has been called
+static int _initStarted;
+
+//! Reset pulse
+static const uint16_t _resetSeq[] =
+{
+    SEQ_RESET, 0,       // Pull RESET low
+    SEQ_DELAY, 1,       // 10us is enough
+    SEQ_RESET, 1,       // RESET high
+    SEQ_DELAY, 120,     // Long enough reset during STB Out mode
+    SEQ_END, 0
+};
+
+//! Reset pulse and HX8352C initialization
+static const uint16_t _initSeq[] =
+{
+    SEQ_RESET, 0,       // Pull RESET low
+    SEQ_DELAY, 1,       // 10us is enough
+    SEQ_RESET, 1,       // RESET high
+    SEQ_DELAY, 120,     // Long enough reset during STB Out mode
+    // Power Voltage Setting
+    0x001A, 0x0004,     // BT[2:0]=100, VCL=-VCI; VGH=VCI+2DDVDH; VGL=-2DDVDH
+    0x001B, 0x008C,     // VCIRE=1; VRH[4:0]=0Ch, VREG1=(2.5v*1.9)=4.75V
+    // VCOM offset
+    0x0023, 0x0000,     // SELVCM=0, R24h and R25h selects VCOM
+    0x0024, 0x0040,     // VCM[6:0]=1000000, VCOMH voltage=VREG1*0.748 (originally 5F)
+    0x0025, 0x000F,     // VDV[4:0]=01111, VCOMH amplitude=VREG*1.00
+    0x002D, 0x0006,     // NOW[2:0]=110, Gate output non-overlap period = 6 clocks
+    SEQ_DELAY, 20,
+    // Power on Setting
+    0x0018, 0x0007,     // RADJ[3:0]=0111, Display frame rate 60Hz
+    0x0019, 0x0001,     // OSC_EN=1, start OSC
+    0x001C, 0x0006,     // AP[2:0]=110, High OPAMP current (default 011)
+    0x0001, 0x0008,     // DSTB=0, out deep sleep; SCROLL=1, vertical scroll mode
+    0x001F, 0x0088,     // STB=0
+    SEQ_DELAY, 5,
+    0x001F, 0x0080,     // DK=0
+    SEQ_DELAY, 5,
+    0x001F, 0x0090,     // PON=1
+    SEQ_DELAY, 5,
+    0x001F, 0x00D0,     // VCOMG=1
+    SEQ_DELAY, 5,
+    0x0017, 0x0005,     // IFPF[2:0]=101, 16-bit/pixel
+    // Panel Configuration
+    0x0036, 0x0011,     // REV_PANEL=1, SM_PANEL=1, GS_PANEL=1, SS_PANEL=1
+    //0x0029, 0x0031,   // NL[5:0]=110001, 400 lines
+    //0x0071, 0x001A,   // RTN0
+    // Gamma 2.2 Setting
+    0x0040, 0x0000,
+    0x0041, 0x0045,
+    0x0042, 0x0045,
+    0x0043, 0x0004,
+    0x0044, 0x0000,
+    0x0045, 0x0008,
+    0x0046, 0x0023,
+    0x0047, 0x0023,
+    0x0048, 0x0077,
+    0x0049, 0x0040,
+    0x004A, 0x0004,
+    0x004B, 0x0000,
+    0x004C, 0x0088,
+    0x004D, 0x0088,
+    0x004E, 0x0088,
+    SEQ_END, 0
+};
+
+//! Display on
+static const uint16_t _onSeq[] =
+{
+    0x0028, 0x0038,     // GON=1; DTE=1; D[1:0]=10
+    SEQ_DELAY, 40,
+    0x0028, 0x003C,     // GON=1; DTE=1; D[1:0]=11
+    SEQ_END, 0
+};
 
-// An external delay_ms() function is needed. We pluck it from emWin
-extern void  GUI_Delay(int Period);
-#define _DelayMS GUI_Delay
+//! Display off
+static const uint16_t _offSeq[] =
+{
+    0x0028, 0x0038,     // GON=1; DTE=1; D[1:0]=10
+    SEQ_DELAY, 40,
+    0x0028, 0x0030,     // GON=1; DTE=1; D[1:0]=00
+    SEQ_END, 0
+};
+
+
+/*===========================================================================*/
+/* Static Functions                                                          */
+/*===========================================================================*/
 
 
 /**
@@ -105,76 +227,176 @@ static void _ConfigPort(void)
 }
 
 
+/**
+ * @brief   Configure TIM8 and DMA2 for asynchronous write
+ * @note    WR pin stays in GPIO mode, it is given to TIM8 only during transfer.
+ */
+static void _ConfigAsync(void)
+{
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM8, ENABLE);
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA2, ENABLE);
+
+    TIM8->CR1 = 0;
+    TIM8->PSC = 0;
+    TIM8->ARR = ASYNC_CYCLE_TICKS - 1;
+    TIM8->CCR1 = ASYNC_WR_HIGH_TICKS;
+    TIM8->CCMR1 = TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE;    // PWM mode 1, WR "H" while CNT < CCR1
+    TIM8->CCER = TIM_CCER_CC1E;
+    TIM8->BDTR = TIM_BDTR_MOE;
+    TIM8->DIER = TIM_DIER_UIE | TIM_DIER_CC1DE;     // Update ends a burst, CC1 feeds data
+    TIM8->CR1 = TIM_CR1_OPM | TIM_CR1_URS;          // Stop at update, UG does not interrupt
+    TIM8->SR = 0;
+
+    DMA2_Channel3->CCR = 0;
+    DMA2_Channel3->CPAR = LCD_Data_GPIOx_BASE + 0x0C;   // GPIOx_ODR
+
+    _asyncBusy = 0;
+    NVIC_EnableIRQ(TIM8_UP_IRQn);
+}
+
+
+/**
+ * @brief   Hand next DMA block to DMA2 Channel 3
+ */
+static void _StartAsyncDma(void)
+{
+    unsigned int n = _asyncDmaRemain;
+    if (n > ASYNC_DMA_BLOCK)
+        n = ASYNC_DMA_BLOCK;
+    DMA2_Channel3->CCR = 0;
+    DMA2->IFCR = DMA_IFCR_CGIF3;
+    DMA2_Channel3->CMAR = (uint32_t)_asyncData;
+    DMA2_Channel3->CNDTR = n;
+    DMA2_Channel3->CCR = DMA_CCR3_PL_1 | DMA_CCR3_MSIZE_0 | DMA_CCR3_PSIZE_0 | DMA_CCR3_MINC | DMA_CCR3_DIR | DMA_CCR3_EN;
+    _asyncData += n;
+    _asyncDmaRemain -= n;
+}
+
+
+/**
+ * @brief   Run TIM8 for next burst of write cycles
+ */
+static void _StartAsyncBurst(void)
+{
+    unsigned int n = _asyncRemain;
+    if (n > ASYNC_BURST)
+        n = ASYNC_BURST;
+    TIM8->RCR = n - 1;
+    TIM8->EGR = TIM_EGR_UG;     // Load RCR, restart counter
+    _asyncRemain -= n;
+    TIM8->CR1 |= TIM_CR1_CEN;
+}
+
+
+/**
+ * @brief   Switch WR pin between GPIO output (0x3) and TIM8 CH1 (0xB), both 50MHz push-pull
+ */
+static inline void _SetWRMode(uint32_t mode)
+{
+    GPIO_TypeDef *port = (GPIO_TypeDef *)LCD_Ctrl_GPIOx_BASE;
+    port->CRL = (port->CRL & ~(0xFUL << (LCD_WR_PinSource * 4))) | (mode << (LCD_WR_PinSource * 4));
+}
+
+
+/**
+ * @brief   Run _pSeq until next delay or end, called from lcdTick()
+ */
+static void _RunSequence(void)
+{
+    const uint16_t *p = _pSeq;
+    unsigned int n;
+    for (;;)
+    {
+        for (n = 0; p[n * 2] < SEQ_DELAY; ++n)
+            ;
+        if (n)
+        {
+            lcdWriteRegSequence(p, n);
+            p += n * 2;
+        }
+        switch (p[0])
+        {
+        case SEQ_DELAY:
+            _seqDelay = p[1] + 1;   // Next tick may be less than 1ms away
+            _pSeq = p + 2;
+            return;
+        case SEQ_RESET:
+            if (p[1])
+                ((GPIO_TypeDef *)LCD_Ctrl_GPIOx_BASE)->BSRR = LCD_RST_Pin;
+            else
+                ((GPIO_TypeDef *)LCD_Ctrl_GPIOx_BASE)->BRR = LCD_RST_Pin;
+            p += 2;
+            break;
+        default:    // SEQ_END
+            _pSeq = NULL;
+            return;
+        }
+    }
+}
+
+
+/**
+ * @brief   Hand a sequence to lcdTick(), it starts on next SysTick
+ */
+static void _StartSequence(const uint16_t *pSeq)
+{
+    lcdWaitIdle();
+    _seqDelay = 1;
+    _pSeq = pSeq;
+}
+
+
 /*===========================================================================*/
 /* Public Functions                                                          */
 /*===========================================================================*/
 
 
+/**
+ * @brief   Advance controller sequence, must be called from SysTick_Handler every 1ms
+ */
+void lcdTick(void)
+{
+    if (_pSeq && (--_seqDelay == 0))
+        _RunSequence();
+}
+
+
 /**
  * @brief   Reset LCD Controller
  */
 void lcdReset(void)
 {
-    GPIO_ResetBits((GPIO_TypeDef *)LCD_Ctrl_GPIOx_BASE, LCD_RST_Pin); // Pull RESET low
-    _DelayMS(1); // 10us is enough
-    GPIO_SetBits((GPIO_TypeDef *)LCD_Ctrl_GPIOx_BASE, LCD_RST_Pin); // RESET high
-    _DelayMS(120); // Long enough reset during STB Out mode
+    _StartSequence(_resetSeq);
+    lcdWaitIdle();
 }
 
 
 /**
- * @brief   Initialize GPIO ports and LCD controller
+ * @brief   Initialize GPIO ports and start LCD controller bring-up in background
+ * @note    Reset and initialization (about 165ms) run from lcdTick(). Other
+ *          peripherals can be initialized meanwhile, but no other lcdXxx
+ *          function may be called until lcdIsBusy() returns 0.
  */
-void lcdInit(void)
+void lcdInitStart(void)
 {
     // Configure ports, etc
     _ConfigPort();
-    // Pulse LCD RESET
-    lcdReset();
-    // Begin HX8352C initialization sequence
-    // Power Voltage Setting
-    lcdWriteReg(0x001A); lcdWriteData(0x0004); // BT[2:0]=100, VCL=-VCI; VGH=VCI+2DDVDH; VGL=-2DDVDH
-    lcdWriteReg(0x001B); lcdWriteData(0x008C); // VCIRE=1; VRH[4:0]=0Ch, VREG1=(2.5v*1.9)=4.75V
-    // VCOM offset
-    lcdWriteReg(0x0023); lcdWriteData(0x0000); // SELVCM=0, R24h and R25h selects VCOM
-    lcdWriteReg(0x0024); lcdWriteData(0x0040); // VCM[6:0]=1000000, VCOMH voltage=VREG1*0.748 (originally 5F)
-    lcdWriteReg(0x0025); lcdWriteData(0x000F); // VDV[4:0]=01111, VCOMH amplitude=VREG*1.00
-    lcdWriteReg(0x002D); lcdWriteData(0x0006); // NOW[2:0]=110, Gate output non-overlap period = 6 clocks
-    GUI_Delay(20);
-    // Power on Setting
-    lcdWriteReg(0x0018); lcdWriteData(0x0007); // RADJ[3:0]=0111, Display frame rate 60Hz
-    lcdWriteReg(0x0019); lcdWriteData(0x0001); // OSC_EN=1, start OSC
-    lcdWriteReg(0x001C); lcdWriteData(0x0006); // AP[2:0]=110, High OPAMP current (default 011)
-    lcdWriteReg(0x0001); lcdWriteData(0x0000); // DSTB=0, out deep sleep
-    lcdWriteReg(0x001F); lcdWriteData(0x0088); // STB=0
-    GUI_Delay(5);
-    lcdWriteReg(0x001F); lcdWriteData(0x0080); // DK=0
-    GUI_Delay(5);
-    lcdWriteReg(0x001F); lcdWriteData(0x0090); // PON=1
-    GUI_Delay(5);
-    lcdWriteReg(0x001F); lcdWriteData(0x00D0); // VCOMG=1
-    GUI_Delay(5);
-    lcdWriteReg(0x0017); lcdWriteData(0x0005); // IFPF[2:0]=101, 16-bit/pixel
-    // Panel Configuration
-    lcdWriteReg(0x0036); lcdWriteData(0x0011); // REV_PANEL=1, SM_PANEL=1, GS_PANEL=1, SS_PANEL=1
-    //lcdWriteReg(0x0029); lcdWriteData(0x0031); // NL[5:0]=110001, 400 lines
-    //lcdWriteReg(0x0071); lcdWriteData(0x001A); // RTN0
-    //Gamma 2.2 Setting
-    lcdWriteReg(0x0040); lcdWriteData(0x0000);
-    lcdWriteReg(0x0041); lcdWriteData(0x0045);
-    lcdWriteReg(0x0042); lcdWriteData(0x0045);
-    lcdWriteReg(0x0043); lcdWriteData(0x0004);
-    lcdWriteReg(0x0044); lcdWriteData(0x0000);
-    lcdWriteReg(0x0045); lcdWriteData(0x0008);
-    lcdWriteReg(0x0046); lcdWriteData(0x0023);
-    lcdWriteReg(0x0047); lcdWriteData(0x0023);
-    lcdWriteReg(0x0048); lcdWriteData(0x0077);
-    lcdWriteReg(0x0049); lcdWriteData(0x0040);
-    lcdWriteReg(0x004A); lcdWriteData(0x0004);
-    lcdWriteReg(0x004B); lcdWriteData(0x0000);
-    lcdWriteReg(0x004C); lcdWriteData(0x0088);
-    lcdWriteReg(0x004D); lcdWriteData(0x0088);
-    lcdWriteReg(0x004E); lcdWriteData(0x0088);
+    _ConfigAsync();
+    _initStarted = 1;
+    _StartSequence(_initSeq);
+}
+
+
+/**
+ * @brief   Initialize GPIO ports and LCD controller
+ * @note    Waits for the bring-up started by lcdInitStart(), starting it first
+ *          if it was not called.
+ */
+void lcdInit(void)
+{
+    if (!_initStarted)
+        lcdInitStart();
+    lcdWaitIdle();
 }
 
 
@@ -183,9 +405,8 @@ void lcdInit(void)
  */
 void lcdOn(void)
 {
-    lcdWriteReg(0x0028); lcdWriteData(0x0038); //GON=1; DTE=1; D[1:0]=10
-    _DelayMS(40);
-    lcdWriteReg(0x0028); lcdWriteData(0x003C); //GON=1; DTE=1; D[1:0]=11
+    _StartSequence(_onSeq);
+    lcdWaitIdle();
     // TODO: Turn on backlight
 }
 
@@ -196,7 +417,82 @@ void lcdOn(void)
 void lcdOff(void)
 {
     // TODO: Turn off backlight
-    lcdWriteReg(0x0028); lcdWriteData(0x0038); //GON=1; DTE=1; D[1:0]=10
-    _DelayMS(40);
-    lcdWriteReg(0x0028); lcdWriteData(0x0030); //GON=1; DTE=1; D[1:0]=00
+    _StartSequence(_offSeq);
+    lcdWaitIdle();
+}
+
+
+/**
+ * @brief   Write data buffer to LCD (RS = 1) in background
+ * @param   pData   Pointer to data array, must stay valid until completion
+ * @param   count   Length of the data array
+ * @param   pfDone  Called from interrupt when the last word is written, may be NULL
+ * @note    WR is generated by TIM8 and data is copied by DMA2, one word every 167ns.
+ *          The CPU is interrupted once every 256 words. No other lcdXxx function
+ *          may be called until lcdIsBusy() returns 0.
+ */
+void lcdWriteMultipleDataAsync(uint16_t *pData, unsigned int count, void (*pfDone)(void))
+{
+    lcdWaitIdle();
+    if (count == 0)
+    {
+        if (pfDone)
+            pfDone();
+        return;
+    }
+    _pfAsyncDone = pfDone;
+    _asyncData = pData;
+    _asyncDmaRemain = count;
+    _asyncRemain = count;
+    _asyncBusy = 1;
+    ((GPIO_TypeDef *)LCD_Ctrl_GPIOx_BASE)->BSRR = LCD_RS_Pin;  // RS = 1
+    _StartAsyncDma();
+    _SetWRMode(0xB);
+    _StartAsyncBurst();
+}
+
+
+/**
+ * @brief   Check if the bus is owned by a background operation
+ * @return  Non-zero while lcdWriteMultipleDataAsync() transfer or a controller
+ *          sequence (lcdInitStart()) is running
+ */
+int lcdIsBusy(void)
+{
+    return _asyncBusy || (_pSeq != NULL);
 }
+
+
+/**
+ * @brief   Wait until background operation completes
+ */
+void lcdWaitIdle(void)
+{
+    while (_asyncBusy || (_pSeq != NULL))
+        ;
+}
+
+
+/**
+ * @brief   TIM8 update interrupt, end of a burst of asynchronous write cycles
+ */
+void TIM8_UP_IRQHandler(void)
+{
+    void (*pfDone)(void);
+    TIM8->SR = ~TIM_SR_UIF;
+    if (_asyncRemain)
+    {
+        if (DMA2_Channel3->CNDTR == 0)
+            _StartAsyncDma();
+        _StartAsyncBurst();
+        return;
+    }
+    // Timer stopped with WR "H", hand WR back to GPIO (ODR bit is still 1)
+    _SetWRMode(0x3);
+    DMA2_Channel3->CCR = 0;
+    pfDone = _pfAsyncDone;
+    _asyncBusy = 0;
+    if (pfDone)
+        pfDone();
+}
+
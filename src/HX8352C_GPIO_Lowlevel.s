@@ -27,12 +27,88 @@
 
 .syntax unified
 
-@ External variables found in LCDAccess.c which define LCD wiring
-.extern LCD_Data_GPIOx_BASE
-.extern LCD_Ctrl_GPIOx_BASE
-.extern LCD_RS_Pin
-.extern LCD_WR_Pin
-.extern LCD_RD_Pin
+@ LCD wiring, resolved at build time
+#include "HX8352C_GPIO_Conf.h"
+
+@ Load 32-bit constant without literal pool access (2 cycles)
+.macro ldimm reg, value
+    movw \reg, #:lower16:\value
+    movt \reg, #:upper16:\value
+.endm
+
+@ Burn given number of cycles (1 cycle each)
+.macro nops count
+    .rept \count
+    mov  r0, r0                     @ NOP
+    .endr
+.endm
+
+@ Read one GRAM word into reg with 361ns RD "L" (r2 = ctrl port, r3 = RD mask, r4 = data port)
+.macro rdword reg
+    strh r3, [r2, #0x14]            @ GPIOx_BRR, RD = 0
+    nops 13                         @ wait 355ns before GRAM data are ready
+    ldrh \reg, [r4, #8]             @ reg = GPIOx_IDR, read bus
+    strh r3, [r2, #0x10]            @ GPIOx_BSRR, RD = 1
+.endm
+
+@ Write low halfword of reg, then shift high halfword down, 8 cycles (111ns)
+@ (r2 = ctrl port, r3 = data port, r4 = WR mask)
+.macro wrlo reg
+    strh \reg, [r3, #0x0C]          @ GPIOx_ODR = low halfword
+    strh r4,  [r2, #0x14]           @ GPIOx_BRR,  WR = 0
+    mov  r0,  r0                    @ NOP, WR "L" >= 15ns
+    strh r4,  [r2, #0x10]           @ GPIOx_BSRR, WR = 1
+    lsr  \reg, \reg, #16            @ reg = high halfword
+    nops 3                          @ write cycle >= 100ns
+.endm
+
+@ Write high halfword left in reg by wrlo, 8 cycles (111ns)
+@ (r2 = ctrl port, r3 = data port, r4 = WR mask)
+.macro wrhi reg
+    strh \reg, [r3, #0x0C]          @ GPIOx_ODR = high halfword
+    strh r4,  [r2, #0x14]           @ GPIOx_BRR,  WR = 0
+    mov  r0,  r0                    @ NOP, WR "L" >= 15ns
+    strh r4,  [r2, #0x10]           @ GPIOx_BSRR, WR = 1
+    nops 4                          @ write cycle >= 100ns
+.endm
+
+@ Expand packed pixels of bpp bits through palette and write them to LCD (RS = 0)
+@ (r0 = data, r1 = diff, r2 = count, r3 = palette)
+.macro wrpacked bpp
+    cmp  r2,  #0                    @ count - 0 ?
+    beq  3f                         @ if (count == 0) return
+    push {r4, r5, r6, r7, lr}
+    ldimm r12, LCD_Ctrl_GPIOx_BASE  @ r12 = LCD control port
+    mov  r4,  #LCD_RS_Pin           @ r4 = RS pin mask
+    strh r4,  [r12, #0x10]          @ GPIOx_BSRR, RS = 1
+    ldimm r4, LCD_Data_GPIOx_BASE   @ r4 = LCD data port
+    mov  r5,  #LCD_WR_Pin           @ r5 = WR pin mask
+    ldrb r6,  [r0], #1              @ r6 = *data; data++
+    mov  r7,  #\bpp                 @ r7 = bpp
+    mul  r7,  r1, r7                @ r7 = diff * bpp
+    add  r7,  r7, #24               @ r7 = 24 + diff * bpp
+    lsl  r6,  r6, r7                @ first pixel to bits [31:32-bpp]
+    rsb  r1,  r1, #(8 / \bpp)       @ r1 = pixels left in byte
+1:
+    lsr  r7,  r6, #(32 - \bpp)      @ r7 = index
+    ldr  r7,  [r3, r7, lsl #2]      @ r7 = palette[index]
+    strh r7,  [r4, #0x0C]           @ GPIOx_ODR = r7
+    strh r5,  [r12, #0x14]          @ GPIOx_BRR,  WR = 0
+    lsl  r6,  r6, #\bpp             @ next pixel, makes WR "L" time
+    strh r5,  [r12, #0x10]          @ GPIOx_BSRR, WR = 1
+    subs r2,  r2, #1                @ count--
+    beq  2f                         @ if (count == 0) goto finish
+    subs r1,  r1, #1                @ pixels left in byte--
+    bne  1b                         @ next pixel in the same byte
+    ldrb r6,  [r0], #1              @ r6 = *data; data++
+    lsl  r6,  r6, #24               @ first pixel to bits [31:32-bpp]
+    mov  r1,  #(8 / \bpp)           @ r1 = pixels left in byte
+    b    1b                         @ next pixel
+2:
+    pop  {r4, r5, r6, r7, lr}
+3:
+    bx   lr                         @ return
+.endm
 
 .section .text
 
@@ -53,16 +129,12 @@
 .thumb
 .thumb_func
 lcdWriteData:
-    ldr  r1,  =LCD_Data_GPIOx_BASE  @ r1 = &LCD_Data_GPIOx_BASE
-    ldr  r1,  [r1]                  @ r1 = LCD_Data_GPIOx_BASE
+    ldimm r1, LCD_Data_GPIOx_BASE   @ r1 = LCD data port
     strh r0,  [r1, #0x0C]           @ GPIOx_ODR = data
-    ldr  r1,  =LCD_Ctrl_GPIOx_BASE  @ r1 = &LCD_Ctrl_GPIOx_BASE
-    ldr  r1,  [r1]                  @ r1 = LCD_Ctrl_GPIOx_BASE
-    ldr  r2,  =LCD_RS_Pin           @ r2 = &LCD_RS_Pin
-    ldrh r2,  [r2]                  @ r2 = LCD_RS_Pin
+    ldimm r1, LCD_Ctrl_GPIOx_BASE   @ r1 = LCD control port
+    mov  r2,  #LCD_RS_Pin           @ r2 = RS pin mask
     strh r2,  [r1, #0x10]           @ GPIOx_BSRR, RS = 1
-    ldr  r2,  =LCD_WR_Pin           @ r2 = &LCD_WR_Pin
-    ldrh r2,  [r2]                  @ r2 = LCD_WR_Pin
+    mov  r2,  #LCD_WR_Pin           @ r2 = WR pin mask
     strh r2,  [r1, #0x14]           @ GPIOx_BRR,  WR = 0
     strh r2,  [r1, #0x10]           @ GPIOx_BSRR, WR = 1
     @ We do not need to wait 100-15=85ns since this function cannot be called again within 85ns
@@ -84,16 +156,12 @@ lcdWriteData:
 .thumb
 .thumb_func
 lcdWriteReg:
-    ldr  r1,  =LCD_Data_GPIOx_BASE  @ r1 = &LCD_Data_GPIOx_BASE
-    ldr  r1,  [r1]                  @ r1 = LCD_Data_GPIOx_BASE
+    ldimm r1, LCD_Data_GPIOx_BASE   @ r1 = LCD data port
     strh r0,  [r1, #0x0C]           @ GPIOx_ODR = data
-    ldr  r1,  =LCD_Ctrl_GPIOx_BASE  @ r2 = &LCD_Ctrl_GPIOx_BASE
-    ldr  r1,  [r1]                  @ r1 = LCD_Ctrl_GPIOx_BASE
-    ldr  r2,  =LCD_RS_Pin           @ r2 = &LCD_RS_Pin
-    ldrh r2,  [r2]                  @ r2 = LCD_RS_Pin
+    ldimm r1, LCD_Ctrl_GPIOx_BASE   @ r1 = LCD control port
+    mov  r2,  #LCD_RS_Pin           @ r2 = RS pin mask
     strh r2,  [r1, #0x14]           @ GPIOx_BRR, RS = 0
-    ldr  r2,  =LCD_WR_Pin           @ r2 = &LCD_WR_Pin
-    ldrh r2,  [r2]                  @ r3 = LCD_WR_Pin
+    mov  r2,  #LCD_WR_Pin           @ r2 = WR pin mask
     strh r2,  [r1, #0x14]           @ GPIOx_BRR,  WR = 0
     strh r2,  [r1, #0x10]           @ GPIOx_BSRR, WR = 1
     @ We do not need to wait 100-15=85ns since this function cannot be called again within 85ns
@@ -101,14 +169,63 @@ lcdWriteReg:
 //! @endcond
 
 
+/**
+ * @fn      void lcdWriteRegSequence(const uint16_t *pPairs, unsigned int count)
+ * @brief   Write a list of register/value pairs to LCD
+ * @param   pPairs  Array of {register, value} pairs (r0)
+ * @param   count   Number of pairs (r1)
+ * @note    This function is written in ARM assembly language.
+ *          Port addresses and pin masks stay in registers for the whole list.
+ *          WR control pulse "L" duration is at least 28ns and each write cycle
+ *          is at least 111ns @ 72MHz processor clock
+ *          (Datasheet requires 15ns "L" and 100ns full write cycle).
+ */
+//! @cond DOXYGEN_SHOW_ASM
+.align 2
+.global lcdWriteRegSequence
+.thumb
+.thumb_func
+lcdWriteRegSequence:
+    cmp  r1,  #0                    @ count == 0 ?
+    beq  .Lwrs_return               @ nothing to write
+    push {r4, r5, r6, lr}
+    ldimm r2, LCD_Data_GPIOx_BASE   @ r2 = LCD data port
+    ldimm r3, LCD_Ctrl_GPIOx_BASE   @ r3 = LCD control port
+    mov  r4,  #LCD_RS_Pin           @ r4 = RS pin mask
+    mov  r5,  #LCD_WR_Pin           @ r5 = WR pin mask
+.Lwrs_loop:
+    ldrh r6,  [r0], #2              @ r6 = *pPairs++, register
+    strh r6,  [r2, #0x0C]           @ GPIOx_ODR = register
+    strh r4,  [r3, #0x14]           @ GPIOx_BRR,  RS = 0
+    strh r5,  [r3, #0x14]           @ GPIOx_BRR,  WR = 0
+    ldrh r6,  [r0], #2              @ r6 = *pPairs++, value
+    strh r5,  [r3, #0x10]           @ GPIOx_BSRR, WR = 1
+    strh r4,  [r3, #0x10]           @ GPIOx_BSRR, RS = 1
+    strh r6,  [r2, #0x0C]           @ GPIOx_ODR = value
+    mov  r0,  r0                    @ NOP, complete 100ns write cycle
+    mov  r0,  r0                    @ NOP
+    strh r5,  [r3, #0x14]           @ GPIOx_BRR,  WR = 0
+    subs r1,  #1                    @ --count
+    strh r5,  [r3, #0x10]           @ GPIOx_BSRR, WR = 1
+    bne  .Lwrs_loop                 @ next pair, loop overhead completes write cycle
+    pop  {r4, r5, r6, lr}
+.Lwrs_return:
+    bx   lr                         @ return
+//! @endcond
+
+
 /**
  * @fn      void lcdWriteMultipleData(uint16_t *pData, unsigned int count)
  * @brief   Write data buffer to LCD (RS = 0)
  * @param   pData   Pointer to data array to be written (r0)
  * @param   count   Length of the data array (r1)
  * @note    This function is written in ARM assembly language.
- *          Loading of new data and conditional jump slows down the writing cycle.
- *          WR control pulse "L" duration is 70ns and "H" duration is 110ns @ 72MHz processor clock.
+ *          After an optional halfword to reach word alignment, the buffer is
+ *          loaded 8 pixels per ldm and written by an unrolled block with WR
+ *          control pulse "L" duration of 28ns and a cycle of 111ns
+ *          (Datasheet requires 15ns "L" and 100ns cycle). The head and the
+ *          last up to 7 pixels go through a halfword loop with WR "L" 28ns
+ *          and a cycle of about 140ns @ 72MHz processor clock.
  */
 //! @cond DOXYGEN_SHOW_ASM
 .align 2
@@ -116,29 +233,138 @@ lcdWriteReg:
 .thumb
 .thumb_func
 lcdWriteMultipleData:
-    push {r4, r5, lr}
-    ldr  r2,  =LCD_Ctrl_GPIOx_BASE  @ r2 = &LCD_Ctrl_GPIOx_BASE
-    ldr  r2,  [r2]                  @ r2 = LCD_Ctrl_GPIOx_BASE
-    ldr  r3,  =LCD_RS_Pin           @ r3 = &LCD_RS_Pin
-    ldrh r3,  [r3]                  @ r3 = LCD_RS_Pin
+    push {r4, r5, r6, r7, lr}
+    ldimm r2, LCD_Ctrl_GPIOx_BASE   @ r2 = LCD control port
+    mov  r3,  #LCD_RS_Pin           @ r3 = RS pin mask
     strh r3,  [r2, #0x10]           @ GPIOx_BSRR, RS = 1
-    ldr  r3,  =LCD_Data_GPIOx_BASE  @ r3 = &LCD_Data_GPIOx_BASE
-    ldr  r3,  [r3]                  @ r3 = LCD_Data_GPIOx_BASE
-    ldr  r4,  =LCD_WR_Pin           @ r4 = &LCD_WR_Pin
-    ldr  r4,  [r4]                  @ r4 = LCD_WR_Pin
-    add  r1,  r1                    @ r1 = r0 + r1 * 2 (each data is 2 bytes)
-    add  r1,  r0, r1                @ end = r1
-    ldrh r5,  [r0]                  @ r5 = *data, preload data
-.Lwmd_loop:
-    cmp  r0,  r1                    @ data - end ?
-    bge  .Lwmd_finish               @ if (data >= end) goto finish
+    ldimm r3, LCD_Data_GPIOx_BASE   @ r3 = LCD data port
+    mov  r4,  #LCD_WR_Pin           @ r4 = WR pin mask
+    cmp  r1,  #0                    @ count - 0 ?
+    beq  .Lwmd_finish               @ if (count == 0) goto finish
+    tst  r0,  #2                    @ data word aligned ?
+    beq  .Lwmd_aligned              @ if so goto aligned
+    @ Head, write one halfword to reach word alignment
+    ldrh r5,  [r0], #2              @ r5 = *data; data++
     strh r5,  [r3, #0x0C]           @ GPIOx_ODR = r5
-    strh r4,  [r2, #0x14]           @ GPIOx_BRR, WR = 0
-    ldrh r5,  [r0, #2]!             @ ++data; r5 = *data;
+    strh r4,  [r2, #0x14]           @ GPIOx_BRR,  WR = 0
+    mov  r0,  r0                    @ NOP
+    strh r4,  [r2, #0x10]           @ GPIOx_BSRR, WR = 1
+    sub  r1,  r1, #1                @ count--
+.Lwmd_aligned:
+    subs r1,  r1, #8                @ count -= 8
+    blo  .Lwmd_tail                 @ if (count < 8) goto tail
+.Lwmd_block:
+    @ Load 8 pixels, also makes WR "H" time of previous pixel
+    ldm  r0!, {r5, r6, r7, r12}     @ r5..r12 = data[0..7]; data += 8
+    wrlo r5                         @ pixel 0
+    wrhi r5                         @ pixel 1
+    wrlo r6                         @ pixel 2
+    wrhi r6                         @ pixel 3
+    wrlo r7                         @ pixel 4
+    wrhi r7                         @ pixel 5
+    wrlo r12                        @ pixel 6
+    @ Pixel 7, loop overhead and ldm complete its write cycle
+    strh r12, [r3, #0x0C]           @ GPIOx_ODR = high halfword
+    strh r4,  [r2, #0x14]           @ GPIOx_BRR,  WR = 0
+    mov  r0,  r0                    @ NOP
+    strh r4,  [r2, #0x10]           @ GPIOx_BSRR, WR = 1
+    subs r1,  r1, #8                @ count -= 8
+    bhs  .Lwmd_block                @ if (count >= 8) next block
+.Lwmd_tail:
+    adds r1,  r1, #8                @ count = remaining pixels (0 - 7)
+    beq  .Lwmd_finish               @ if (count == 0) goto finish
+.Lwmd_tailloop:
+    ldrh r5,  [r0], #2              @ r5 = *data; data++
+    strh r5,  [r3, #0x0C]           @ GPIOx_ODR = r5
+    strh r4,  [r2, #0x14]           @ GPIOx_BRR,  WR = 0
+    mov  r0,  r0                    @ NOP
     strh r4,  [r2, #0x10]           @ GPIOx_BSRR, WR = 1
-    b .Lwmd_loop;                   @ next
+    subs r1,  r1, #1                @ count--
+    bne  .Lwmd_tailloop             @ next
 .Lwmd_finish:
-    pop  {r4, r5, pc}
+    pop  {r4, r5, r6, r7, pc}
+//! @endcond
+
+
+/**
+ * @fn      void lcdWriteMultipleDataLUT(const uint8_t *pIndex, const LCD_PIXELINDEX *pLUT, unsigned int count)
+ * @brief   Write palette indexed data buffer to LCD (RS = 0)
+ * @param   pIndex  Pointer to 8-bit color index array (r0)
+ * @param   pLUT    Palette, 32-bit entries with RGB565 color in lower half (r1)
+ * @param   count   Length of the index array (r2)
+ * @note    This function is written in ARM assembly language.
+ *          Each pixel is looked up and strobed in the same loop.
+ *          WR control pulse "L" duration is 28ns and the cycle is about 153ns
+ *          @ 72MHz processor clock.
+ */
+//! @cond DOXYGEN_SHOW_ASM
+.align 2
+.global lcdWriteMultipleDataLUT
+.thumb
+.thumb_func
+lcdWriteMultipleDataLUT:
+    cmp  r2,  #0                    @ count - 0 ?
+    beq  .Lwml_return               @ if (count == 0) return
+    push {r4, r5, lr}
+    ldimm r12, LCD_Ctrl_GPIOx_BASE  @ r12 = LCD control port
+    mov  r3,  #LCD_RS_Pin           @ r3 = RS pin mask
+    strh r3,  [r12, #0x10]          @ GPIOx_BSRR, RS = 1
+    ldimm r3, LCD_Data_GPIOx_BASE   @ r3 = LCD data port
+    mov  r4,  #LCD_WR_Pin           @ r4 = WR pin mask
+.Lwml_loop:
+    ldrb r5,  [r0], #1              @ r5 = *index; index++
+    ldr  r5,  [r1, r5, lsl #2]      @ r5 = lut[r5]
+    strh r5,  [r3, #0x0C]           @ GPIOx_ODR = r5
+    strh r4,  [r12, #0x14]          @ GPIOx_BRR,  WR = 0
+    mov  r0,  r0                    @ NOP
+    strh r4,  [r12, #0x10]          @ GPIOx_BSRR, WR = 1
+    subs r2,  r2, #1                @ count--
+    bne  .Lwml_loop                 @ next, loop overhead and lookup make WR "H" time
+    pop  {r4, r5, lr}
+.Lwml_return:
+    bx   lr                         @ return
+//! @endcond
+
+
+/**
+ * @fn      void lcdWriteMultipleData2BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+ * @brief   Write a row of 2bpp packed pixels through palette to LCD (RS = 0)
+ * @param   pData   Pointer to packed pixels, first pixel in the most significant bits (r0)
+ * @param   diff    Number of pixels to skip in the first byte, [0:3] (r1)
+ * @param   count   Number of pixels to write (r2)
+ * @param   pLUT    Palette, 32-bit entries with RGB565 color in lower half (r3)
+ * @note    This function is written in ARM assembly language.
+ *          WR control pulse "L" duration is 28ns and the cycle is about 153ns
+ *          @ 72MHz processor clock.
+ */
+//! @cond DOXYGEN_SHOW_ASM
+.align 2
+.global lcdWriteMultipleData2BPP
+.thumb
+.thumb_func
+lcdWriteMultipleData2BPP:
+    wrpacked 2
+//! @endcond
+
+
+/**
+ * @fn      void lcdWriteMultipleData4BPP(const uint8_t *pData, unsigned int diff, unsigned int count, const LCD_PIXELINDEX *pLUT)
+ * @brief   Write a row of 4bpp packed pixels through palette to LCD (RS = 0)
+ * @param   pData   Pointer to packed pixels, first pixel in the most significant bits (r0)
+ * @param   diff    Number of pixels to skip in the first byte, [0:1] (r1)
+ * @param   count   Number of pixels to write (r2)
+ * @param   pLUT    Palette, 32-bit entries with RGB565 color in lower half (r3)
+ * @note    This function is written in ARM assembly language.
+ *          WR control pulse "L" duration is 28ns and the cycle is about 153ns
+ *          @ 72MHz processor clock.
+ */
+//! @cond DOXYGEN_SHOW_ASM
+.align 2
+.global lcdWriteMultipleData4BPP
+.thumb
+.thumb_func
+lcdWriteMultipleData4BPP:
+    wrpacked 4
 //! @endcond
 
 
@@ -160,16 +386,12 @@ lcdWriteMultipleData:
 .thumb
 .thumb_func
 lcdWriteRepeatingData:
-    ldr  r2,  =LCD_Data_GPIOx_BASE  @ r2 = &LCD_Data_GPIOx_BASE
-    ldr  r2,  [r2]                  @ r2 = LCD_Data_GPIOx_BASE
+    ldimm r2, LCD_Data_GPIOx_BASE   @ r2 = LCD data port
     strh r0,  [r2, #0x0C]           @ GPIOx_ODR = r0
-    ldr  r3,  =LCD_Ctrl_GPIOx_BASE  @ r3 = &LCD_Ctrl_GPIOx_BASE
-    ldr  r3,  [r3]                  @ r3 = LCD_Ctrl_GPIOx_BASE
-    ldr  r2,  =LCD_RS_Pin           @ r2 = &LCD_RS_Pin
-    ldrh r2,  [r2]                  @ r2 = LCD_RS_Pin
+    ldimm r3, LCD_Ctrl_GPIOx_BASE   @ r3 = LCD control port
+    mov  r2,  #LCD_RS_Pin           @ r2 = RS pin mask
     strh r2,  [r3, #0x10]           @ GPIOx_BSRR, RS = 1
-    ldr  r2,  =LCD_WR_Pin           @ r2 = &LCD_WR_Pin
-    ldrh r2,  [r2]                  @ r2 = LCD_WR_Pin
+    mov  r2,  #LCD_WR_Pin           @ r2 = WR pin mask
     cmp  r1,  #40                   @ count - 40 ?
     blo  .Lwrd_lastlot              @ if (count < 40) goto lastlot
 .Lwrd_batchloop:
@@ -913,19 +1135,15 @@ lcdWriteRepeatingData:
 .thumb_func
 lcdReadReg:
     push {r4, lr}
-    ldr  r1, =LCD_Ctrl_GPIOx_BASE   @ r1 = &LCD_Ctrl_GPIOx_BASE
-    ldr  r1, [r1]                   @ r1 = LCD_Ctrl_GPIOx_BASE
-    ldr  r2, =LCD_RS_Pin            @ r2 = &LCD_RS_Pin
-    ldrh r2, [r2]                   @ r2 = LCD_RS_Pin
+    ldimm r1, LCD_Ctrl_GPIOx_BASE   @ r1 = LCD control port
+    mov  r2,  #LCD_RS_Pin           @ r2 = RS pin mask
     strh r2, [r1, #0x10]            @ GPIOx_BSRR, RS = 1
-    ldr  r2, =LCD_RD_Pin            @ r2 = &LCD_RD_Pin
-    ldrh r2, [r2]                   @ r2 = LCD_RD_Pin
+    mov  r2,  #LCD_RD_Pin           @ r2 = RD pin mask
     strh r2, [r1, #0x14]            @ GPIOx_BRR, RD = 0
     @ Now we need to wait 45ns before register data are ready
     @ Do some meaningful things first
     @ Set data bus to input
-    ldr  r3, =LCD_Data_GPIOx_BASE   @ r3 = &LCD_Data_GPIOx_BASE
-    ldr  r3, [r3]                   @ r3 = LCD_Data_GPIOx_BASE
+    ldimm r3, LCD_Data_GPIOx_BASE   @ r3 = LCD data port
     mov  r4, #0x44444444            @ r4 = 0x44444444
     str  r4, [r3]                   @ DATA_CRL = 0x44444444
     str  r4, [r3, #4]               @ DATA_CRH = 0x44444444
@@ -959,23 +1177,21 @@ lcdReadReg:
 .thumb_func
 lcdReadData:
     push {r4, lr}
-    ldr  r1, =LCD_Ctrl_GPIOx_BASE   @ r1 = &LCD_Ctrl_GPIOx_BASE
-    ldr  r1, [r1]                   @ r1 = LCD_Ctrl_GPIOx_BASE
-    ldr  r2, =LCD_RS_Pin            @ r2 = &LCD_RS_Pin
-    ldrh r2, [r2]                   @ r2 = LCD_RS_Pin
+    ldimm r1, LCD_Ctrl_GPIOx_BASE   @ r1 = LCD control port
+    mov  r2,  #LCD_RS_Pin           @ r2 = RS pin mask
     strh r2, [r1, #0x10]            @ GPIOx_BSRR, RS = 1
-    ldr  r2, =LCD_RD_Pin            @ r2 = &LCD_RD_Pin
-    ldrh r2, [r2]                   @ r2 = LCD_RD_Pin
+    mov  r2,  #LCD_RD_Pin           @ r2 = RD pin mask
     strh r2, [r1, #0x14]            @ GPIOx_BRR, RD = 0
     @ Now we need to wait 355ns before GRAM data are ready
     @ Do some meaningful things then wait
     @ Set data bus to input
-    ldr  r3, =LCD_Data_GPIOx_BASE   @ r3 = &LCD_Data_GPIOx_BASE
-    ldr  r3, [r3]                   @ r3 = LCD_Data_GPIOx_BASE
+    ldimm r3, LCD_Data_GPIOx_BASE   @ r3 = LCD data port
     mov  r4, #0x44444444            @ r4 = 0x44444444
     str  r4, [r3]                   @ DATA_CRL = 0x44444444
     str  r4, [r3, #4]               @ DATA_CRH = 0x44444444
-    @ Wait some more
+    @ Wait some more, RD "L" >= 355ns: 26 cycles (361ns) @ 72MHz
+    mov  r0, r0                     @ NOP
+    mov  r0, r0                     @ NOP
     mov  r0, r0                     @ NOP
     mov  r0, r0                     @ NOP
     mov  r0, r0                     @ NOP
@@ -995,14 +1211,16 @@ lcdReadData:
 
 /**
  * @fn      void lcdReadMultipleData(uint16_t *pData, unsigned int count)
- * @brief   Read multiple 16-bit data from LCD GRAM (RS = 1)
+ * @brief   Read multiple 16-bit data from LCD GRAM (RS = 1) in one burst
  * @param   pData   Pointer to the data array to store result (r0)
  * @param   count   Number of data to read (r1)
  * @note    RD control pulse "L" duration is 361ns and "H" duration is 112ns
  *          @ 72MHz processor clock
  *          (Datasheet requires 355ns "L" and 450ns full cycle for GRAM).
- *          Caller must first write Register (R22h) using @p lcdWriteReg, then call
- *          this function to read GRAM value.
+ *          The data bus is turned to input once before the first word and back
+ *          to output once after the last word, so longer bursts amortize the
+ *          turnaround. Caller must first write Register (R22h) using
+ *          @p lcdWriteReg, then call this function to read GRAM value.
  */
 //! @cond DOXYGEN_SHOW_ASM
 .align 2
@@ -1011,34 +1229,38 @@ lcdReadData:
 .thumb_func
 lcdReadMultipleData:
     push {r4, r5, lr}
-    ldr  r2, =LCD_Ctrl_GPIOx_BASE   @ r2 = &LCD_Ctrl_GPIOx_BASE
-    ldr  r2, [r2]                   @ r2 = LCD_Ctrl_GPIOx_BASE
-    ldr  r3, =LCD_RS_Pin            @ r3 = &LCD_RS_Pin
-    ldrh r3, [r3]                   @ r3 = LCD_RS_Pin
+    ldimm r2, LCD_Ctrl_GPIOx_BASE   @ r2 = LCD control port
+    mov  r3,  #LCD_RS_Pin           @ r3 = RS pin mask
     strh r3, [r2, #0x10]            @ GPIOx_BSRR, RS = 1
-    ldr  r3, =LCD_RD_Pin            @ r3 = &LCD_RD_Pin
-    ldrh r3, [r3]                   @ r3 = LCD_RD_Pin
+    mov  r3,  #LCD_RD_Pin           @ r3 = RD pin mask
+    ldimm r4, LCD_Data_GPIOx_BASE   @ r4 = LCD data port
     add  r1,  r1                    @ r1 = r0 + r1 * 2 (each data is 2 bytes)
     add  r1,  r0, r1                @ end = r1
+    @ Set data bus to input, once for the whole burst
+    mov  r5, #0x44444444            @ r5 = 0x44444444
+    str  r5, [r4]                   @ DATA_CRL = 0x44444444
+    str  r5, [r4, #4]               @ DATA_CRH = 0x44444444
 .Lrmd_loop:
     cmp  r0,  r1                    @ data - end ?
     bge  .Lrmd_finish               @ if (data >= end) goto finish
     strh r3, [r2, #0x14]            @ GPIOx_BRR, RD = 0
     @ Now we need to wait 355ns before GRAM data are ready
-    @ Do some meaningful things then wait
-    @ Set data bus to input, we can do this outisde the loop but anyway we have some time to kill
-    ldr  r4, =LCD_Data_GPIOx_BASE   @ r4 = &LCD_Data_GPIOx_BASE
-    ldr  r4, [r4]                   @ r4 = LCD_Data_GPIOx_BASE
-    mov  r5, #0x44444444            @ r5 = 0x44444444
-    str  r5, [r4]                   @ DATA_CRL = 0x44444444
-    str  r5, [r4, #4]               @ DATA_CRH = 0x44444444
-    @ Wait some more
+    @ RD "L" >= 355ns: 26 cycles (361ns) @ 72MHz
+    mov  r0, r0                     @ NOP
+    mov  r0, r0                     @ NOP
     mov  r0, r0                     @ NOP
     mov  r0, r0                     @ NOP
     mov  r0, r0                     @ NOP
     mov  r0, r0                     @ NOP
-    ldrh r5, [r4, #8]               @ r6 = GPIOx_IDR, read bus
-    strh r5, [r0], #2               @ *data = r6; data++
+    mov  r0, r0                     @ NOP
+    mov  r0, r0                     @ NOP
+    mov  r0, r0                     @ NOP
+    mov  r0, r0                     @ NOP
+    mov  r0, r0                     @ NOP
+    mov  r0, r0                     @ NOP
+    mov  r0, r0                     @ NOP
+    ldrh r5, [r4, #8]               @ r5 = GPIOx_IDR, read bus
+    strh r5, [r0], #2               @ *data = r5; data++
     strh r3, [r2, #0x10]            @ GPIOx_BSRR, RD = 1
     @ Again we need to kill 450-355=95ns
     mov  r0, r0                     @ NOP
@@ -1050,6 +1272,79 @@ lcdReadMultipleData:
     str  r5,  [r4, #4]              @ DATA_CRH = 0x11111111
     pop  {r4, r5, pc}               @ return
 
+//! @endcond
+
+
+/**
+ * @fn      void lcdReadPixels565(uint16_t *pData, unsigned int count)
+ * @brief   Read GRAM pixels from LCD and convert them to RGB565 (RS = 1)
+ * @param   pData   Pointer to the pixel array to store result (r0)
+ * @param   count   Number of pixels to read (r1)
+ * @note    GRAM reads back 3 words per 2 pixels, each byte holding one left
+ *          aligned 6-bit component (R1G1, B1R2, G2B2). This function does the
+ *          dummy read, unpacks each pair during RD "H" time and reads only 2
+ *          words for an odd last pixel. RD "L" duration is 361ns per word.
+ *          Caller must first write Register (R22h) using @p lcdWriteReg.
+ */
+//! @cond DOXYGEN_SHOW_ASM
+.align 2
+.global lcdReadPixels565
+.thumb
+.thumb_func
+lcdReadPixels565:
+    push {r4, r5, r6, r7, lr}
+    ldimm r2, LCD_Ctrl_GPIOx_BASE   @ r2 = LCD control port
+    mov  r3,  #LCD_RS_Pin           @ r3 = RS pin mask
+    strh r3, [r2, #0x10]            @ GPIOx_BSRR, RS = 1
+    mov  r3,  #LCD_RD_Pin           @ r3 = RD pin mask
+    ldimm r4, LCD_Data_GPIOx_BASE   @ r4 = LCD data port
+    @ Set data bus to input, once for the whole burst
+    mov  r5, #0x44444444            @ r5 = 0x44444444
+    str  r5, [r4]                   @ DATA_CRL = 0x44444444
+    str  r5, [r4, #4]               @ DATA_CRH = 0x44444444
+    rdword r5                       @ dummy read
+    nops 6                          @ RD "H" >= 95ns
+.Lrp_loop:
+    subs r1, r1, #2                 @ count -= 2
+    blo  .Lrp_tail                  @ if (count < 2) goto tail
+    rdword r5                       @ r5 = R1G1
+    nops 6                          @ RD "H" >= 95ns
+    rdword r6                       @ r6 = B1R2
+    @ Pixel 1, these also make RD "H" time
+    and  r12, r5, #0xF800           @ r12 = R1
+    and  r5,  r5, #0x00FC           @ r5 = G1
+    orr  r12, r12, r5, lsl #3       @ r12 |= G1
+    orr  r12, r12, r6, lsr #11      @ r12 |= B1
+    strh r12, [r0], #2              @ *data = r12; data++
+    mov  r0, r0                     @ NOP
+    rdword r7                       @ r7 = G2B2
+    @ Pixel 2, RD "H" time is covered by these and the loop branch
+    lsl  r12, r6, #8                @ r12 = R2 << 8
+    and  r12, r12, #0xF800          @ r12 = R2
+    and  r5,  r7, #0xFC00           @ r5 = G2
+    orr  r12, r12, r5, lsr #5       @ r12 |= G2
+    and  r5,  r7, #0x00F8           @ r5 = B2
+    orr  r12, r12, r5, lsr #3       @ r12 |= B2
+    strh r12, [r0], #2              @ *data = r12; data++
+    b    .Lrp_loop                  @ next pair
+.Lrp_tail:
+    cmn  r1,  #1                    @ one pixel left (count == -1) ?
+    bne  .Lrp_finish                @ if not goto finish
+    rdword r5                       @ r5 = R1G1
+    nops 6                          @ RD "H" >= 95ns
+    rdword r6                       @ r6 = B1xx
+    and  r12, r5, #0xF800           @ r12 = R1
+    and  r5,  r5, #0x00FC           @ r5 = G1
+    orr  r12, r12, r5, lsl #3       @ r12 |= G1
+    orr  r12, r12, r6, lsr #11      @ r12 |= B1
+    strh r12, [r0]                  @ *data = r12
+.Lrp_finish:
+    @ Set bus back to output
+    mov  r5,  #0x11111111           @ r5 = 0x11111111
+    str  r5,  [r4]                  @ DATA_CRL = 0x11111111
+    str  r5,  [r4, #4]              @ DATA_CRH = 0x11111111
+    pop  {r4, r5, r6, r7, pc}       @ return
+
 .end
 
 //! @endcond
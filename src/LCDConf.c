@@ -48,14 +48,22 @@ void LCD_X_Config(void)
     pDevice = GUI_DEVICE_CreateAndLink(GUIDRV_HX8352C, GUICC_565, 0, 0);
     // Display driver is compile-time configured. Setting (virtual) screen size is not necessary
     //LCD_SetSizeEx (0, 400, 200);
-    //LCD_SetVSizeEx(0, 400, 200);
+    // A virtual size of up to 432 lines along the scroll axis enables hardware scrolling by GUI_SetOrg()
+    //LCD_SetVSizeEx(0, 432, 240);
     // Port access functions
     hwAPI.pfWriteReg = lcdWriteReg;
     hwAPI.pfWriteData = lcdWriteData;
+    hwAPI.pfWriteRegSequence = lcdWriteRegSequence;
     hwAPI.pfWriteRepeatingData = lcdWriteRepeatingData;
     hwAPI.pfWriteMultipleData = lcdWriteMultipleData;
+    hwAPI.pfWriteMultipleDataLUT = lcdWriteMultipleDataLUT;
+    hwAPI.pfWriteMultipleData2BPP = lcdWriteMultipleData2BPP;
+    hwAPI.pfWriteMultipleData4BPP = lcdWriteMultipleData4BPP;
     hwAPI.pfReadData = lcdReadData;
     hwAPI.pfReadMultipleData = lcdReadMultipleData;
+    hwAPI.pfReadPixels565 = lcdReadPixels565;
+    hwAPI.pfWriteMultipleDataAsync = lcdWriteMultipleDataAsync;
+    hwAPI.pfWaitIdle = lcdWaitIdle;
     // Give driver access to the functions
     GUIDRV_HX8352C_SetFunc(pDevice, &hwAPI);
 }
@@ -5,6 +5,7 @@
 #include <stddef.h>
 #include <stm32f10x.h>
 #include "GUI.h"
+#include "HX8352C.h"
 
 
 /*===========================================================================*/
@@ -59,6 +60,8 @@ int main(void)
 
     // Configurations
     _ConfigSysTick();
+    // LCD bring-up runs from SysTick while the rest is configured, GUI_Init() waits for it
+    lcdInitStart();
     _ConfigGPIO();
     _ConfigNVIC();
     _ConfigTimer();
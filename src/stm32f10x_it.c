@@ -23,6 +23,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f10x_it.h"
+#include "HX8352C.h"
 
 /** @addtogroup STM32F10x_StdPeriph_Template
   * @{
@@ -138,6 +139,7 @@ extern volatile int OS_TimeMS;
 void SysTick_Handler(void)
 {
   ++OS_TimeMS;
+  lcdTick();
 }
 
 /******************************************************************************/